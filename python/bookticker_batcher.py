@@ -0,0 +1,75 @@
+import asyncio
+import logging
+import time
+
+from flatbuffer_encoder import encode_bookticker_batch
+
+logger = logging.getLogger(__name__)
+
+
+def symbol_registry_hash(names: list[str]) -> int:
+    """FNV-1a over the sorted names, each followed by a newline (SymbolRegistry::fingerprint)."""
+    h = 0xCBF29CE484222325
+    for name in names:
+        for byte in name.encode() + b"\n":
+            h = ((h ^ byte) * 0x100000001B3) & 0xFFFFFFFFFFFFFFFF
+    return h
+
+
+class BookTickerBatcher:
+    """
+    Buffers bookTicker updates from every symbol and publishes them as one
+    BookTickerBatch frame (topic "bookticker_batch") once `max_quotes` are queued or
+    `max_delay_us` has passed since the first one, whichever comes first.
+
+    Symbol ids are positions in the sorted symbol list, the same ids the C++
+    SymbolRegistry assigns from binance_symbols.json.
+
+    The single topic cannot be filtered per symbol by the SUB socket; the C++
+    pipeline drops the quotes of symbols no open window subscribed to.
+    """
+
+    def __init__(self, publisher, symbols: list[str], max_quotes: int = 64, max_delay_us: int = 1000):
+        names = sorted(set(symbols))
+        self.ids = {name: i for i, name in enumerate(names)}
+        self.registry_hash = symbol_registry_hash(names)
+        self.publisher = publisher
+        self.max_quotes = max_quotes
+        self.max_delay = max_delay_us / 1_000_000
+        self.quotes = []
+        self.flush_handle = None
+        self.pending_sends = set()
+
+    def add(self, symbol: str, payload: dict):
+        symbol_id = self.ids.get(symbol)
+        if symbol_id is None:
+            return
+        self.quotes.append((
+            symbol_id,
+            int(payload.get("u", 0)),
+            time.time_ns(),
+            float(payload.get("b", 0.0)),
+            float(payload.get("B", 0.0)),
+            float(payload.get("a", 0.0)),
+            float(payload.get("A", 0.0)),
+        ))
+        if len(self.quotes) >= self.max_quotes:
+            self.flush()
+        elif self.flush_handle is None:
+            self.flush_handle = asyncio.get_running_loop().call_later(self.max_delay, self.flush)
+
+    def flush(self):
+        if self.flush_handle is not None:
+            self.flush_handle.cancel()
+            self.flush_handle = None
+        if not self.quotes:
+            return
+
+        fb_bytes = encode_bookticker_batch(self.quotes, time.time_ns(), self.registry_hash)
+        logger.debug(f"[BookTickerBatcher] Flushing {len(self.quotes)} quotes ({len(fb_bytes)} bytes)")
+        self.quotes = []
+
+        # Tasks run in creation order, so frames go out in order
+        task = asyncio.get_running_loop().create_task(self.publisher.publish("bookticker_batch", fb_bytes))
+        self.pending_sends.add(task)
+        task.add_done_callback(self.pending_sends.discard)
@@ -1,10 +1,16 @@
 import asyncio
+import logging
+import os
 import websockets
 import orjson
 from pathlib import Path
 import sys
 
+logger = logging.getLogger(__name__)
+
 BASE_URL = "wss://stream.binance.us:9443/ws"
+# Combined endpoint; NIKTRADE_BINANCE_WS=ws://127.0.0.1:<port>/stream points it at a local stand-in
+COMBINED_URL = os.environ.get("NIKTRADE_BINANCE_WS", "wss://stream.binance.us:9443/stream")
 
 async def book_ticker_stream(symbol: str):
     url = f"{BASE_URL}/{symbol}@bookTicker"
@@ -22,6 +28,187 @@ async def book_ticker_stream(symbol: str):
         except Exception as e:
             print("Connection failed:", e)
 
+async def depth_stream(symbol: str, update_speed_ms: int = 100):
+    """
+    Diff depth stream (<symbol>@depth). Each event carries U/u update ids and
+    absolute quantities for the changed levels; quantity "0" removes a level.
+    """
+    url = f"{BASE_URL}/{symbol}@depth@{update_speed_ms}ms"
+    async with websockets.connect(url) as ws:
+        print(f"Connected to {symbol} depth stream!")
+        try:
+            while True:
+                msg = await ws.recv()
+                payload = orjson.loads(msg)
+                yield payload
+        except websockets.ConnectionClosed:
+            print("Connection closed.")
+        except asyncio.CancelledError:
+            print("\nStreaming cancelled by user.")
+        except Exception as e:
+            print("Connection failed:", e)
+
+async def trade_stream(symbol: str):
+    """Raw trade stream (<symbol>@trade): one event per executed trade."""
+    url = f"{BASE_URL}/{symbol}@trade"
+    async with websockets.connect(url) as ws:
+        print(f"Connected to {symbol} trade stream!")
+        try:
+            while True:
+                msg = await ws.recv()
+                payload = orjson.loads(msg)
+                yield payload
+        except websockets.ConnectionClosed:
+            print("Connection closed.")
+        except asyncio.CancelledError:
+            print("\nStreaming cancelled by user.")
+        except Exception as e:
+            print("Connection failed:", e)
+
+async def kline_stream(symbol: str, interval: str = "1m"):
+    """
+    Kline stream (<symbol>@kline_<interval>): pushes the forming candle whenever it
+    changes and the final version once it closes ("x": true).
+    """
+    url = f"{BASE_URL}/{symbol}@kline_{interval}"
+    async with websockets.connect(url) as ws:
+        print(f"Connected to {symbol} kline_{interval} stream!")
+        try:
+            while True:
+                msg = await ws.recv()
+                payload = orjson.loads(msg)
+                yield payload
+        except websockets.ConnectionClosed:
+            print("Connection closed.")
+        except asyncio.CancelledError:
+            print("\nStreaming cancelled by user.")
+        except Exception as e:
+            print("Connection failed:", e)
+
+class CombinedStream:
+    """
+    One websocket on the combined endpoint multiplexing every subscribed stream
+    ("bnbusdt@bookTicker", ...). Messages arrive as {"stream": name, "data": payload}
+    and go to that stream's handler; a handler may return an awaitable, which is
+    awaited before the next message so per-stream order is kept.
+
+    subscribe()/unsubscribe() take effect on the live connection through
+    SUBSCRIBE/UNSUBSCRIBE frames, coalesced to stay under Binance's limit of 5
+    incoming messages per second. A reconnect requests the current set in the URL,
+    the same way the C++ BinanceWsFeed does.
+    """
+
+    MAX_STREAMS = 1024            # Binance's per-connection limit
+    CONTROL_INTERVAL = 0.25       # Seconds between SUBSCRIBE/UNSUBSCRIBE frames
+    MIN_BACKOFF, MAX_BACKOFF = 1, 30
+
+    def __init__(self, url: str = COMBINED_URL):
+        self.url = url
+        self.handlers = {}
+        self.to_subscribe = set()
+        self.to_unsubscribe = set()
+        self.ws = None
+        self.task = None
+        self.request_id = 0
+        self.changed = asyncio.Event()
+
+    def active(self, stream: str) -> bool:
+        return stream in self.handlers
+
+    def subscribe(self, stream: str, handler):
+        if stream not in self.handlers:
+            if len(self.handlers) >= self.MAX_STREAMS:
+                raise RuntimeError(f"combined stream limit ({self.MAX_STREAMS}) reached")
+            self.to_unsubscribe.discard(stream)
+            self.to_subscribe.add(stream)
+            self.changed.set()
+        self.handlers[stream] = handler
+        if self.task is None:
+            self.task = asyncio.create_task(self.run(), name="combined_stream")
+
+    def unsubscribe(self, stream: str):
+        if self.handlers.pop(stream, None) is None:
+            return
+        self.to_subscribe.discard(stream)
+        self.to_unsubscribe.add(stream)
+        self.changed.set()
+
+    async def close(self):
+        if self.task is not None:
+            self.task.cancel()
+            await asyncio.gather(self.task, return_exceptions=True)
+            self.task = None
+
+    async def run(self):
+        backoff = self.MIN_BACKOFF
+        while True:
+            while not self.handlers:
+                self.changed.clear()
+                await self.changed.wait()
+
+            # Everything subscribed so far goes in the URL; frames only carry later changes
+            url = f"{self.url}?streams={'/'.join(self.handlers)}"
+            self.to_subscribe.clear()
+            self.to_unsubscribe.clear()
+            try:
+                async with websockets.connect(url, max_size=None, compression=None) as ws:
+                    logger.info(f"[CombinedStream] Connected with {len(self.handlers)} streams")
+                    backoff = self.MIN_BACKOFF
+                    self.ws = ws
+                    control = asyncio.create_task(self.send_changes(ws))
+                    try:
+                        await self.read(ws)
+                    finally:
+                        control.cancel()
+                        self.ws = None
+                logger.warning("[CombinedStream] Connection closed by server")
+            except asyncio.CancelledError:
+                raise
+            except Exception as e:
+                logger.warning(f"[CombinedStream] Connection failed: {e}")
+
+            await asyncio.sleep(backoff)
+            backoff = min(backoff * 2, self.MAX_BACKOFF)
+
+    async def read(self, ws):
+        async for msg in ws:
+            message = orjson.loads(msg)
+            handler = self.handlers.get(message.get("stream"))
+            if handler is None:
+                if message.get("error") is not None:
+                    logger.warning(f"[CombinedStream] Request {message.get('id')} failed: {message['error']}")
+                # Replies to our requests, and stragglers from streams just unsubscribed
+                continue
+            try:
+                pending = handler(message["data"])
+                if pending is not None:
+                    await pending
+            except Exception as e:
+                logger.exception(f"[CombinedStream] Handler for {message['stream']} failed: {e}")
+
+    async def send_changes(self, ws):
+        loop = asyncio.get_running_loop()
+        last_sent = 0.0
+        while True:
+            self.changed.clear()
+            if not self.to_subscribe and not self.to_unsubscribe:
+                await self.changed.wait()
+                continue
+            # Waiting out the interval also lets a burst of start_stream calls share one frame
+            await asyncio.sleep(max(0.0, last_sent + self.CONTROL_INTERVAL - loop.time()))
+
+            if self.to_unsubscribe:
+                method, streams = "UNSUBSCRIBE", self.to_unsubscribe
+            else:
+                method, streams = "SUBSCRIBE", self.to_subscribe
+            if not streams:
+                continue
+            self.request_id += 1
+            params = sorted(streams)
+            streams.clear()
+            await ws.send(orjson.dumps({"method": method, "params": params, "id": self.request_id}).decode())
+            last_sent = loop.time()
+            logger.info(f"[CombinedStream] {method} {len(params)} streams (id {self.request_id})")
 
 if __name__ == "__main__":
     async def main():
@@ -5,6 +5,7 @@ from datetime import datetime, timedelta
 from pathlib import Path
 
 BASE_REST_URL = "https://api.binance.us/api/v3/klines"
+DEPTH_REST_URL = "https://api.binance.us/api/v3/depth"
 
 async def fetch_historical_klines(session, symbol: str, interval: str, start_time: int = None, end_time: int = None, limit: int = 500):
     """
@@ -43,6 +44,21 @@ async def fetch_historical_klines(session, symbol: str, interval: str, start_tim
             }
             yield candle_dict  # yield each candle one by one
 
+async def fetch_depth_snapshot(session, symbol: str, limit: int = 1000):
+    """
+    Fetch an order book snapshot from Binance.US REST API.
+
+    Returns {"lastUpdateId": int, "bids": [[price, qty], ...], "asks": [[price, qty], ...]}
+    """
+    params = {
+        "symbol": symbol.upper(),
+        "limit": limit
+    }
+
+    async with session.get(DEPTH_REST_URL, params=params) as resp:
+        resp.raise_for_status()
+        return await resp.json(loads=orjson.loads)
+
 async def main():
     symbol = "BNBBTC"
     interval = "1m"
@@ -7,7 +7,11 @@ sys.path.append(str(flatbuffers_path))
 
 import flatbuffers
 from Binance import BookTicker  # Generated FlatBuffers Python module for BookTicker stream
+from Binance import BookTickerBatch, Quote # Generated FlatBuffers Python module for batched BookTicker frames
 from Binance import Klines, Kline # Generated FlatBuffers Python module for Kline stream
+from Binance import DepthUpdate, PriceLevel # Generated FlatBuffers Python module for depth stream
+from Binance import Trade # Generated FlatBuffers Python module for trade stream
+from Binance import ControlOp, ControlStatus, ControlRequest, ControlReply, ControlResult # Generated FlatBuffers Python module for batched control requests
 
 def encode_bookticker(payload: dict) -> bytes:
     builder = flatbuffers.Builder(1024)
@@ -33,6 +37,30 @@ def encode_bookticker(payload: dict) -> bytes:
     return bytes(builder.Output())
 
 
+def encode_bookticker_batch(quotes: list[tuple], publish_time_ns: int, registry_hash: int) -> bytes:
+    """
+    Encode buffered bookTicker updates as one BookTickerBatch.
+
+    Args:
+        quotes: (symbol_id, update_id, receive_time_ns, bid, bid_qty, ask, ask_qty) tuples
+    """
+    builder = flatbuffers.Builder(64 + 56 * len(quotes))
+
+    BookTickerBatch.BookTickerBatchStartQuotesVector(builder, len(quotes))
+    for quote in reversed(quotes):
+        Quote.CreateQuote(builder, *quote)
+    quotes_vector = builder.EndVector(len(quotes))
+
+    BookTickerBatch.BookTickerBatchStart(builder)
+    BookTickerBatch.BookTickerBatchAddQuotes(builder, quotes_vector)
+    BookTickerBatch.BookTickerBatchAddPublishTimeNs(builder, publish_time_ns)
+    BookTickerBatch.BookTickerBatchAddRegistryHash(builder, registry_hash)
+    fb_obj = BookTickerBatch.BookTickerBatchEnd(builder)
+    builder.Finish(fb_obj)
+
+    return bytes(builder.Output())
+
+
 def encode_klines(candle_list: list[dict]) -> bytes:
     """
     Encode a list of historical kline dictionaries into a FlatBuffers Klines object.
@@ -42,6 +70,7 @@ def encode_klines(candle_list: list[dict]) -> bytes:
             open_time, open_price, high_price, low_price, close_price,
             volume, close_time, quote_asset_volume, number_of_trades,
             taker_buy_base, taker_buy_quote, ignore
+            and optionally is_closed (default False: the candle may still change)
     Returns:
         Serialized FlatBuffer bytes
     """
@@ -73,6 +102,7 @@ def encode_klines(candle_list: list[dict]) -> bytes:
         Kline.KlineAddTakerBuyBase(builder, taker_base)
         Kline.KlineAddTakerBuyQuote(builder, taker_quote)
         Kline.KlineAddIgnore(builder, ignore)
+        Kline.KlineAddIsClosed(builder, bool(candle.get("is_closed", False)))
         kline_offsets.append(Kline.KlineEnd(builder))
 
     # Create a vector of KlineData
@@ -87,4 +117,156 @@ def encode_klines(candle_list: list[dict]) -> bytes:
     fb_obj = Klines.KlinesEnd(builder)
     builder.Finish(fb_obj)
 
-    return bytes(builder.Output())
\ No newline at end of file
+    return bytes(builder.Output())
+
+def _encode_depth(symbol: str, is_snapshot: bool, first_update_id: int, final_update_id: int,
+                  event_time: int, bids: list, asks: list) -> bytes:
+    # Levels are [price, qty] string pairs from Binance; converted once here so the
+    # C++ side can read them straight out of the buffer
+    builder = flatbuffers.Builder(64 + 16 * (len(bids) + len(asks)))
+
+    symbol_offset = builder.CreateString(symbol)
+
+    DepthUpdate.DepthUpdateStartBidsVector(builder, len(bids))
+    for price, qty in reversed(bids):
+        PriceLevel.CreatePriceLevel(builder, float(price), float(qty))
+    bids_vector = builder.EndVector(len(bids))
+
+    DepthUpdate.DepthUpdateStartAsksVector(builder, len(asks))
+    for price, qty in reversed(asks):
+        PriceLevel.CreatePriceLevel(builder, float(price), float(qty))
+    asks_vector = builder.EndVector(len(asks))
+
+    DepthUpdate.DepthUpdateStart(builder)
+    DepthUpdate.DepthUpdateAddSymbol(builder, symbol_offset)
+    DepthUpdate.DepthUpdateAddIsSnapshot(builder, is_snapshot)
+    DepthUpdate.DepthUpdateAddFirstUpdateId(builder, first_update_id)
+    DepthUpdate.DepthUpdateAddFinalUpdateId(builder, final_update_id)
+    DepthUpdate.DepthUpdateAddEventTime(builder, event_time)
+    DepthUpdate.DepthUpdateAddBids(builder, bids_vector)
+    DepthUpdate.DepthUpdateAddAsks(builder, asks_vector)
+    fb_obj = DepthUpdate.DepthUpdateEnd(builder)
+    builder.Finish(fb_obj)
+
+    return bytes(builder.Output())
+
+
+def encode_depth_update(payload: dict) -> bytes:
+    """Encode a <symbol>@depth diff event (keys s, E, U, u, b, a)."""
+    return _encode_depth(
+        payload.get("s", "UNKNOWN"),
+        False,
+        int(payload.get("U", 0)),
+        int(payload.get("u", 0)),
+        int(payload.get("E", 0)),
+        payload.get("b", []),
+        payload.get("a", []),
+    )
+
+
+def encode_depth_snapshot(snapshot: dict, symbol: str) -> bytes:
+    """Encode a REST /api/v3/depth snapshot (keys lastUpdateId, bids, asks)."""
+    return _encode_depth(
+        symbol.upper(),
+        True,
+        0,
+        int(snapshot.get("lastUpdateId", 0)),
+        0,
+        snapshot.get("bids", []),
+        snapshot.get("asks", []),
+    )
+
+
+def encode_trade(payload: dict) -> bytes:
+    """Encode a <symbol>@trade event (keys s, t, p, q, T, E, m)."""
+    builder = flatbuffers.Builder(128)
+
+    symbol = builder.CreateString(payload.get("s", "UNKNOWN"))
+
+    Trade.TradeStart(builder)
+    Trade.TradeAddSymbol(builder, symbol)
+    Trade.TradeAddTradeId(builder, int(payload.get("t", 0)))
+    Trade.TradeAddPrice(builder, float(payload.get("p", 0.0)))
+    Trade.TradeAddQuantity(builder, float(payload.get("q", 0.0)))
+    Trade.TradeAddTradeTime(builder, int(payload.get("T", 0)))
+    Trade.TradeAddEventTime(builder, int(payload.get("E", 0)))
+    Trade.TradeAddIsBuyerMaker(builder, bool(payload.get("m", False)))
+    fb_obj = Trade.TradeEnd(builder)
+    builder.Finish(fb_obj)
+
+    return bytes(builder.Output())
+
+
+def encode_kline_event(payload: dict) -> bytes:
+    """Encode one <symbol>@kline event as a single-candle Klines buffer."""
+    k = payload.get("k", {})
+    candle = {
+        "open_time": k.get("t", 0),
+        "open_price": k.get("o", "0.0"),
+        "high_price": k.get("h", "0.0"),
+        "low_price": k.get("l", "0.0"),
+        "close_price": k.get("c", "0.0"),
+        "volume": k.get("v", "0.0"),
+        "close_time": k.get("T", 0),
+        "quote_asset_volume": k.get("q", "0.0"),
+        "number_of_trades": k.get("n", 0),
+        "taker_buy_base": k.get("V", "0.0"),
+        "taker_buy_quote": k.get("Q", "0.0"),
+        "ignore": k.get("B", "0"),
+        "is_closed": bool(k.get("x", False)),
+    }
+    return encode_klines([candle])
+
+
+# ------------------- Control protocol (port 5560) -------------------
+# ControlOp values -> the text command each one stands for
+CONTROL_OP_COMMANDS = {
+    ControlOp.ControlOp.StartStream: "start_stream",
+    ControlOp.ControlOp.CloseStream: "close_stream",
+    ControlOp.ControlOp.FireKlines: "fire_klines",
+    ControlOp.ControlOp.SubscribeKlines: "subscribe_klines",
+    ControlOp.ControlOp.StartTrades: "start_trades",
+    ControlOp.ControlOp.DepthSnapshot: "depth_snapshot",
+}
+
+def is_control_request(buf: bytes) -> bool:
+    """True for a ControlRequest (file identifier NKCT); text commands never match."""
+    return len(buf) >= 8 and ControlRequest.ControlRequest.ControlRequestBufferHasIdentifier(buf, 0)
+
+def decode_control_request(buf: bytes) -> tuple[int, list[tuple[str, str, int, int]]]:
+    """Returns (request_id, [(command, symbol, start_time, end_time), ...]) in item order."""
+    request = ControlRequest.ControlRequest.GetRootAs(buf, 0)
+    items = []
+    for i in range(request.ItemsLength()):
+        item = request.Items(i)
+        symbol = item.Symbol()
+        command = CONTROL_OP_COMMANDS.get(item.Op(), f"op{item.Op()}")
+        items.append((command, symbol.decode().lower() if symbol else "", item.StartTime(), item.EndTime()))
+    return request.RequestId(), items
+
+def encode_control_reply(request_id: int, replies: list[str]) -> bytes:
+    """One ControlResult per text reply ("OK" or "ERROR: ..."), in request item order."""
+    builder = flatbuffers.Builder(64 + 32 * len(replies))
+
+    results = []
+    for reply in replies:
+        ok = reply == "OK"
+        message = None if ok else builder.CreateString(reply.removeprefix("ERROR: "))
+        ControlResult.ControlResultStart(builder)
+        ControlResult.ControlResultAddStatus(builder, ControlStatus.ControlStatus.Ok if ok else ControlStatus.ControlStatus.Error)
+        if message is not None:
+            ControlResult.ControlResultAddMessage(builder, message)
+        results.append(ControlResult.ControlResultEnd(builder))
+
+    ControlReply.ControlReplyStartResultsVector(builder, len(results))
+    for result in reversed(results):
+        builder.PrependUOffsetTRelative(result)
+    results_vector = builder.EndVector(len(results))
+
+    ControlReply.ControlReplyStart(builder)
+    ControlReply.ControlReplyAddRequestId(builder, request_id)
+    ControlReply.ControlReplyAddResults(builder, results_vector)
+    fb_obj = ControlReply.ControlReplyEnd(builder)
+    builder.Finish(fb_obj, file_identifier=b"NKCT")
+
+    return bytes(builder.Output())
@@ -1,6 +1,7 @@
 import asyncio
 import json
 import logging
+import os
 from pathlib import Path
 import time
 
@@ -8,10 +9,12 @@ import aiohttp
 import zmq
 import zmq.asyncio
 
-from crypto_connection import book_ticker_stream
-from crypto_historical_data import fetch_historical_klines
-from flatbuffer_encoder import encode_bookticker, encode_klines
-from zmq_publisher import ZMQPublisher
+from crypto_connection import CombinedStream, depth_stream, trade_stream, kline_stream
+from crypto_historical_data import fetch_historical_klines, fetch_depth_snapshot
+from flatbuffer_encoder import encode_klines, encode_depth_update, encode_depth_snapshot, encode_trade, encode_kline_event
+from flatbuffer_encoder import is_control_request, decode_control_request, encode_control_reply
+from zmq_publisher import ZMQPublisher, signal_ready
+from bookticker_batcher import BookTickerBatcher
 
 import sys
 
@@ -49,143 +52,326 @@ async def fetch_binance_symbols():
     logger.info(f"[INFO] Saved {len(symbols)} trading pairs to {SYMBOL_FILE}")
     return symbols
 
-# ---------------------- Stream for a single symbol ----------------------
-async def stream_for_symbol(symbol: str, publisher, latency_publisher):
-    logger.info(f"[INFO] Starting stream task for {symbol}")
-    last_msg_time = None
+# ---------------------- BookTicker for a single symbol ----------------------
+def stream_for_symbol(symbol: str, book_tickers: CombinedStream, batcher: BookTickerBatcher):
+    """
+    Adds <symbol>@bookTicker to the shared combined connection. Every update goes
+    straight to the batcher (buffered with every other symbol's updates; the quote's
+    receive time replaces the separate feed_latency message).
+    """
+    stream = f"{symbol}@bookTicker"
+    if book_tickers.active(stream):
+        return False
+    book_tickers.subscribe(stream, lambda payload: batcher.add(symbol, payload))
+    logger.info(f"[INFO] Subscribed {stream}")
+    return True
+
+# ---------------------- Depth for a single symbol ----------------------
+async def publish_depth_snapshot(session, symbol: str, publisher):
+    snapshot = await fetch_depth_snapshot(session, symbol)
+    await publisher.publish(f"depth.{symbol}", encode_depth_snapshot(snapshot, symbol))
+    logger.info(f"[INFO] Published depth snapshot for {symbol} (lastUpdateId {snapshot.get('lastUpdateId')})")
+
+async def stream_depth_for_symbol(symbol: str, publisher):
+    """
+    Publishes every diff on depth.<symbol>; the snapshot is fetched once the first diff
+    has arrived and goes out on the same topic. The C++ book buffers diffs until it
+    sees the snapshot and drops the ones the snapshot already covers.
+    """
+    logger.info(f"[INFO] Starting depth task for {symbol}")
+    snapshot_sent = False
 
     try:
-        async for payload in book_ticker_stream(symbol):
-            if shutdown_event.is_set():
-                break
+        async with aiohttp.ClientSession() as session:
+            async for payload in depth_stream(symbol):
+                if shutdown_event.is_set():
+                    break
 
-            now = int(time.time() * 1000)
-            latency = f"{now - last_msg_time} ms" if last_msg_time else "Loading..."
-            last_msg_time = now
+                await publisher.publish(f"depth.{symbol}", encode_depth_update(payload))
 
-            # Publish latency
-            await latency_publisher.publish("feed_latency", f"{symbol} {latency}".encode())
-            fb_bytes = encode_bookticker(payload)
-            await publisher.publish(f"bookticker.{symbol}", fb_bytes)
+                if not snapshot_sent:
+                    snapshot_sent = True
+                    await publish_depth_snapshot(session, symbol, publisher)
 
-            await asyncio.sleep(0.05)
+    except asyncio.CancelledError:
+        logger.info(f"[INFO] Depth task for {symbol} cancelled cleanly")
+    except Exception as e:
+        logger.exception(f"[ERROR] Unexpected error in stream_depth_for_symbol({symbol}): {e}")
+
+# ---------------------- Trades for a single symbol ----------------------
+async def stream_trades_for_symbol(symbol: str, klines_publisher: ZMQPublisher):
+    """Live trades on trade.<symbol>; the C++ BarAggregator builds the candles from them."""
+    logger.info(f"[INFO] Starting trade task for {symbol}")
+
+    try:
+        async for payload in trade_stream(symbol):
+            if shutdown_event.is_set():
+                break
+            await klines_publisher.publish(f"trade.{symbol}", encode_trade(payload))
 
     except asyncio.CancelledError:
-        logger.info(f"[INFO] Stream task for {symbol} cancelled cleanly")
+        logger.info(f"[INFO] Trade task for {symbol} cancelled cleanly")
     except Exception as e:
-        logger.exception(f"[ERROR] Unexpected error in stream_for_symbol({symbol}): {e}")
+        logger.exception(f"[ERROR] Unexpected error in stream_trades_for_symbol({symbol}): {e}")
 
 # ------------------- Historical Klines Task -------------------
-async def fetch_and_publish_klines(symbol: str, klines_publisher: ZMQPublisher):
+KLINE_PAGE_LIMIT = 1000  # Binance.US maximum per klines request
+KLINE_CLOSED_MARGIN_MS = 10_000  # A REST candle counts as final this long after its close_time
+
+async def fetch_and_publish_klines(symbol: str, klines_publisher: ZMQPublisher, start_time: int = 0, end_time: int = 0):
+    """
+    The latest 1000 1m candles, or with start_time every candle from start_time to
+    end_time (0 = now). The dashboard asks for ranges its on-disk cache is missing.
+    One message per REST page, so each message is an unbroken run of candles. A REST row
+    carries no final flag, so one is marked closed only once its close_time is safely past.
+    Raises on a failed page, so a fire_klines request replies with the error and is retried.
+    """
     try:
         async with aiohttp.ClientSession() as session:
-            candles = []
-            async for candle in fetch_historical_klines(session, symbol, interval="1m", limit=400):
-                if shutdown_event.is_set():
+            while True:
+                candles = []
+                async for candle in fetch_historical_klines(session, symbol, interval="1m", start_time=start_time or None,
+                                                            end_time=end_time or None, limit=KLINE_PAGE_LIMIT):
+                    if shutdown_event.is_set():
+                        break
+                    candles.append(candle)
+
+                if candles:
+                    closed_before = int(time.time() * 1000) - KLINE_CLOSED_MARGIN_MS
+                    for candle in candles:
+                        candle["is_closed"] = candle["close_time"] < closed_before
+                    fb_bytes = encode_klines(candles)
+                    await klines_publisher.publish(f"klines.{symbol}", fb_bytes)
+                    logger.info(f"[INFO] Published {len(candles)} historical candles for {symbol}")
+
+                if not start_time or len(candles) < KLINE_PAGE_LIMIT or shutdown_event.is_set():
+                    break
+                start_time = candles[-1]["open_time"] + 1
+                if end_time and start_time > end_time:
                     break
-                candles.append(candle)
-
-            if candles:
-                fb_bytes = encode_klines(candles)
-                await klines_publisher.publish(f"klines.{symbol}", fb_bytes)
-                logger.info(f"[INFO] Published {len(candles)} historical candles for {symbol}")
 
     except asyncio.CancelledError:
         pass
     except Exception as e:
         logger.error(f"[ERROR] Klines task {symbol}: {e}")
+        raise
+
+# ------------------- Live Klines Task -------------------
+async def stream_klines_for_symbol(symbol: str, klines_publisher: ZMQPublisher, interval: str = "1m", start_time: int = 0):
+    """
+    Push mode: one REST backfill (from start_time if given), then only the candles the
+    kline stream reports as changed (one candle per message instead of the whole window).
+    """
+    logger.info(f"[INFO] Starting kline subscription for {symbol}")
+    try:
+        await fetch_and_publish_klines(symbol, klines_publisher, start_time)
+    except Exception:
+        pass  # Already logged; the live updates still start
+
+    try:
+        async for payload in kline_stream(symbol, interval):
+            if shutdown_event.is_set():
+                break
+            await klines_publisher.publish(f"klines.{symbol}", encode_kline_event(payload))
+
+    except asyncio.CancelledError:
+        logger.info(f"[INFO] Kline subscription for {symbol} cancelled cleanly")
+    except Exception as e:
+        logger.exception(f"[ERROR] Unexpected error in stream_klines_for_symbol({symbol}): {e}")
 
-# ---------------------- REQ/REP Control Server ----------------------
-async def control_server(stream_tasks: list, publisher, latency_publisher, klines_publisher, rep_endpoint="tcp://127.0.0.1:5560"):
+# ---------------------- Control Commands ----------------------
+async def run_control_command(cmd: str, symbol: str, stream_tasks: list, publisher, book_tickers, batcher, klines_publisher,
+                              start_time: int = 0, end_time: int = 0) -> str:
+    """
+    Runs one control command and returns the reply text ("OK" or "ERROR: ...").
+    start_time/end_time (open_time ms, batch requests only) narrow the kline backfill.
     """
-    REQ/REP server: handles start_symbol & fire_klines without blocking responses.
+    if cmd == "start_stream":
+        try:
+            logger.info(f"[INFO] Starting stream to symbol: {symbol}")
+
+            # Subscribing returns False if the symbol already has a running stream
+            if stream_for_symbol(symbol, book_tickers, batcher):
+                depth_task = asyncio.create_task(
+                    stream_depth_for_symbol(symbol, publisher),
+                    name=f"depth.{symbol}"
+                )
+                stream_tasks.append(depth_task)
+                logger.info(f"[INFO] Stream for {symbol} started")
+            else:
+                logger.info(f"[INFO] Stream for {symbol} already active")
+
+            return "OK"
+
+        except Exception as e:
+            logger.exception(f"[ERROR] start_symbol failed for {symbol}: {e}")
+            return f"ERROR: {e}"
+
+    elif cmd == "close_stream":
+        try:
+            logger.info(f"[INFO] Closing stream for symbol: {symbol}")
+
+            was_active = book_tickers.active(f"{symbol}@bookTicker")
+            book_tickers.unsubscribe(f"{symbol}@bookTicker")
+            tasks_to_close = [
+                t for t in stream_tasks if t.get_name() == f"depth.{symbol}"
+            ]
+
+            if was_active or tasks_to_close:
+                for t in tasks_to_close:
+                    t.cancel()
+                    stream_tasks.remove(t)
+
+                # Cleanup finishes in the background; the reply doesn't wait for it
+                async def cleanup(tasks):
+                    await asyncio.gather(*tasks, return_exceptions=True)
+
+                asyncio.create_task(cleanup(tasks_to_close))
+
+                logger.info(f"[INFO] Stream for {symbol} closed")
+            else:
+                logger.info(f"[INFO] No active stream for {symbol}")
+            return "OK"
+
+        except Exception as e:
+            logger.exception(f"[ERROR] close_stream failed for {symbol}: {e}")
+            return f"ERROR: {e}"
+
+    elif cmd == "fire_klines":
+        try:
+            if start_time:
+                logger.info(f"[INFO] Fetching historical klines for {symbol} from {start_time} to {end_time or 'now'}")
+            else:
+                logger.info(f"[INFO] Fetching historical klines for {symbol}")
+            # Replies once the candles are published; only this request waits for the download
+            await fetch_and_publish_klines(symbol, klines_publisher, start_time, end_time)
+            return "OK"
+        except Exception as e:
+            logger.error(f"[ERROR] Failed klines task for {symbol}: {e}")
+            return f"ERROR: {e}"
+
+    elif cmd == "subscribe_klines":
+        try:
+            already_running = any(
+                t.get_name() == f"kline.{symbol}" for t in stream_tasks
+            )
+
+            if not already_running:
+                task = asyncio.create_task(
+                    stream_klines_for_symbol(symbol, klines_publisher, start_time=start_time),
+                    name=f"kline.{symbol}"
+                )
+                stream_tasks.append(task)
+                logger.info(f"[INFO] Kline subscription for {symbol} started")
+            else:
+                logger.info(f"[INFO] Kline subscription for {symbol} already active")
+
+            return "OK"
+        except Exception as e:
+            logger.exception(f"[ERROR] subscribe_klines failed for {symbol}: {e}")
+            return f"ERROR: {e}"
+
+    elif cmd == "start_trades":
+        try:
+            already_running = any(
+                t.get_name() == f"trade.{symbol}" for t in stream_tasks
+            )
+
+            if not already_running:
+                task = asyncio.create_task(
+                    stream_trades_for_symbol(symbol, klines_publisher),
+                    name=f"trade.{symbol}"
+                )
+                stream_tasks.append(task)
+                logger.info(f"[INFO] Trade task for {symbol} started")
+            else:
+                logger.info(f"[INFO] Trade stream for {symbol} already active")
+
+            return "OK"
+        except Exception as e:
+            logger.exception(f"[ERROR] start_trades failed for {symbol}: {e}")
+            return f"ERROR: {e}"
+
+    elif cmd == "depth_snapshot":
+        try:
+            # Requested by the C++ book after a sequence gap
+            logger.info(f"[INFO] Resyncing depth snapshot for {symbol}")
+            async with aiohttp.ClientSession() as session:
+                await publish_depth_snapshot(session, symbol, publisher)
+            return "OK"
+        except Exception as e:
+            logger.error(f"[ERROR] Failed depth snapshot for {symbol}: {e}")
+            return f"ERROR: {e}"
+
+    logger.warning(f"[WARN] Unknown control command: {cmd}")
+    return f"ERROR: unknown command {cmd}"
+
+# ---------------------- ROUTER Control Server ----------------------
+async def control_server(stream_tasks: list, publisher, book_tickers, batcher, klines_publisher, router_endpoint="tcp://127.0.0.1:5560", bound=None):
+    """
+    ROUTER server: handles start_stream, close_stream, fire_klines, subscribe_klines,
+    start_trades & depth_snapshot.
     Port: 5560
+
+    Every request runs as its own task and is answered whenever it finishes, so a
+    slow fire_klines download never holds up a start_stream sent after it.
+    The C++ ZMQControlClient (DEALER) sends [empty][correlation id][request] and gets
+    [empty][correlation id][reply] back; a plain REQ client's [empty][request] works too.
+    The request is either "cmd symbol" text or a ControlRequest FlatBuffer
+    (binance_control.fbs) carrying a whole batch, answered with one ControlReply
+    once every item is done.
+    `bound` (an asyncio.Event) is set once the socket is listening.
     """
-    logger.info(f"[INFO] Control server listening at {rep_endpoint}")
+    logger.info(f"[INFO] Control server listening at {router_endpoint}")
     context = zmq.asyncio.Context.instance()
-    socket = context.socket(zmq.REP)
-    socket.bind(rep_endpoint)
+    socket = context.socket(zmq.ROUTER)
+    socket.setsockopt(zmq.LINGER, 0)
+    socket.bind(router_endpoint)
+    if bound is not None:
+        bound.set()
+    in_flight = set()
+
+    async def answer(envelope, cmd, symbol):
+        reply = await run_control_command(cmd, symbol, stream_tasks, publisher, book_tickers, batcher, klines_publisher)
+        await socket.send_multipart(envelope + [reply.encode()])
+
+    async def answer_batch(envelope, request):
+        try:
+            request_id, items = decode_control_request(request)
+        except Exception as e:
+            logger.error(f"[ERROR] Malformed control batch: {e}")
+            await socket.send_multipart(envelope + [b"ERROR: malformed control batch"])
+            return
+        logger.info(f"[INFO] Control batch {request_id}: {len(items)} items")
+        # Items run concurrently but start in order, so start/close of one symbol keep their order
+        replies = await asyncio.gather(*(
+            run_control_command(cmd, symbol, stream_tasks, publisher, book_tickers, batcher, klines_publisher, start_time, end_time)
+            for cmd, symbol, start_time, end_time in items
+        ))
+        await socket.send_multipart(envelope + [encode_control_reply(request_id, replies)])
 
     while not shutdown_event.is_set():
         try:
-            msg = await socket.recv_string()
+            # Routing identity, empty delimiter and (DEALER only) correlation id, then the request
+            *envelope, request = await socket.recv_multipart()
+            if is_control_request(request):
+                task = asyncio.create_task(answer_batch(envelope, request))
+                in_flight.add(task)
+                task.add_done_callback(in_flight.discard)
+                continue
+
+            msg = request.decode(errors="replace")
             logger.info(f"[INFO] Control message received: {msg}")
             parts = msg.strip().split()
             if len(parts) != 2:
-                await socket.send_string("ERROR: invalid format")
+                await socket.send_multipart(envelope + [b"ERROR: invalid format"])
                 continue
 
             cmd, symbol = parts
             symbol = symbol.lower()
-
-            if cmd == "start_stream":
-                try:
-                    logger.info(f"[INFO] Starting stream to symbol: {symbol}")
-
-                    # Check if symbol already has a running stream
-                    already_running = any(
-                        t.get_name() == symbol for t in stream_tasks
-                    )
-
-                    if not already_running:
-                        task = asyncio.create_task(
-                            stream_for_symbol(symbol, publisher, latency_publisher),
-                            name=symbol
-                        )
-                        stream_tasks.append(task)
-                        logger.info(f"[INFO] Stream task for {symbol} started")
-                    else:
-                        logger.info(f"[INFO] Stream for {symbol} already active")
-
-                    await socket.send_string("OK")
-
-                except Exception as e:
-                    logger.exception(f"[ERROR] start_symbol failed for {symbol}: {e}")
-                    await socket.send_string(f"ERROR: {e}")
-                    
-            elif cmd == "close_stream":
-                try:
-                    logger.info(f"[INFO] Closing stream for symbol: {symbol}")
-
-                    task_to_close = None
-                    for t in stream_tasks:
-                        if t.get_name() == symbol:
-                            task_to_close = t
-                            break
-
-                    if task_to_close:
-                        task_to_close.cancel()
-                        stream_tasks.remove(task_to_close)
-
-                        # Ensure proper cleanup without blocking control loop
-                        async def cleanup(t):
-                            await asyncio.gather(t, return_exceptions=True)
-
-                        asyncio.create_task(cleanup(task_to_close))
-
-                        logger.info(f"[INFO] Stream task for {symbol} closed")
-                        await socket.send_string("OK")
-                    else:
-                        logger.info(f"[INFO] No active stream for {symbol}")
-                        await socket.send_string("OK")
-
-                except Exception as e:
-                    logger.exception(f"[ERROR] close_stream failed for {symbol}: {e}")
-                    await socket.send_string(f"ERROR: {e}")
-
-            elif cmd == "fire_klines":
-                try:
-                    logger.info(f"[INFO] Fetching historical klines for {symbol}")
-                    # Run the fetch/publish task but wait here since it's usually quick
-                    await fetch_and_publish_klines(symbol, klines_publisher)
-                    await socket.send_string("OK")
-                except Exception as e:
-                    logger.error(f"[ERROR] Failed klines task for {symbol}: {e}")
-                    await socket.send_string(f"ERROR: {e}")
-
-            else:
-                logger.warning(f"[WARN] Unknown control command: {cmd}")
-                await socket.send_string(f"ERROR: unknown command {cmd}")
+            task = asyncio.create_task(answer(envelope, cmd, symbol), name=f"control.{cmd}.{symbol}")
+            in_flight.add(task)
+            task.add_done_callback(in_flight.discard)
 
         except asyncio.CancelledError:
             logger.info("[INFO] Control server cancelled")
@@ -194,6 +380,9 @@ async def control_server(stream_tasks: list, publisher, latency_publisher, kline
             logger.exception(f"[ERROR] Exception in control_server: {e}")
             await asyncio.sleep(0.1)
 
+    for task in list(in_flight):
+        task.cancel()
+    await asyncio.gather(*in_flight, return_exceptions=True)
     socket.close()
     logger.info("[INFO] Control server exiting")
 
@@ -203,34 +392,52 @@ async def main():
     symbols = await fetch_binance_symbols()
 
     publisher = ZMQPublisher("tcp://127.0.0.1:5555")
-    latency_publisher = ZMQPublisher("tcp://127.0.0.1:5561")
     klines_publisher = ZMQPublisher("tcp://127.0.0.1:5556")
+    batcher = BookTickerBatcher(publisher, symbols)
+    # Every symbol's bookTicker shares this one connection
+    book_tickers = CombinedStream()
 
     stream_tasks = []
 
     # Start initial streams
     """ USE LATER FOR TESTING PURPOSES
     for sym in symbols[:2]:
-        task = asyncio.create_task(stream_for_symbol(sym, publisher, latency_publisher))
-        stream_tasks.append(task)
+        stream_for_symbol(sym, book_tickers, batcher)
     """
-    # Start control server
-    control_task = asyncio.create_task(control_server(stream_tasks, publisher, latency_publisher, klines_publisher))
-
-    # Fetch historical klines for first symbol
-    klines_task = asyncio.create_task(fetch_and_publish_klines(symbols[0], klines_publisher))
-
+    # Start control server; once it is listening every socket is bound, so tell the app
+    control_bound = asyncio.Event()
+    control_task = asyncio.create_task(control_server(stream_tasks, publisher, book_tickers, batcher, klines_publisher, bound=control_bound))
+    bound_wait = asyncio.create_task(control_bound.wait())
+    await asyncio.wait({control_task, bound_wait}, return_when=asyncio.FIRST_COMPLETED)
+    if control_bound.is_set():
+        await signal_ready()
+    else:
+        bound_wait.cancel()
+
+    # No startup kline download: the dashboard serves the chart from its cache and asks
+    # (fire_klines/subscribe_klines with a time range) only for what is missing
     await shutdown_event.wait()
 
     # Cleanup
     for t in stream_tasks:
         t.cancel()
-    klines_task.cancel()
     control_task.cancel()
-    await asyncio.gather(*stream_tasks, klines_task, control_task, return_exceptions=True)
+    await asyncio.gather(*stream_tasks, control_task, return_exceptions=True)
+    await book_tickers.close()
+
+def run(coro):
+    """uvloop when it is installed (Linux/macOS); NIKTRADE_UVLOOP=0 forces the stock loop."""
+    if os.environ.get("NIKTRADE_UVLOOP", "1") != "0" and not sys.platform.startswith("win"):
+        try:
+            import uvloop
+            logger.info("[INFO] Running on uvloop")
+            return uvloop.run(coro)
+        except ImportError:
+            pass
+    return asyncio.run(coro)
 
 if __name__ == "__main__":
     try:
-        asyncio.run(main())
+        run(main())
     except KeyboardInterrupt:
         shutdown_event.set()
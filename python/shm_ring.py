@@ -0,0 +1,135 @@
+import logging
+import mmap
+import os
+import platform
+import struct
+
+logger = logging.getLogger(__name__)
+
+# Shared-memory broadcast ring read by the C++ transport (src/core/net/shm_ring.hpp
+# documents the layout; the offsets below must match it).
+#
+# Records and writePos are written with plain stores: Python has no release store.
+# The C++ reader's acquire load only sees them in order under x86's total store order,
+# so on any other CPU the ring is refused and both ends stay on ZMQ.
+X86_MACHINES = {"x86_64", "amd64", "i386", "i686", "x86"}
+RING_MAGIC = 0x42524B4E  # "NKRB"
+RING_VERSION = 1
+CLAIM_POS_OFFSET = 64
+WRITE_POS_OFFSET = 72
+WAKE_SEQ_OFFSET = 128
+WAITERS_OFFSET = 132
+DATA_OFFSET = 256
+RECORD_HEADER = struct.Struct("<IIII")  # size, kind, topic size, payload size
+RECORD_DATA = 0
+RECORD_PAD = 1
+DEFAULT_CAPACITY = 16 * 1024 * 1024
+
+
+def _futex_waker():
+    """FUTEX_WAKE on the ring's wakeSeq word (Linux only; readers elsewhere poll)."""
+    if platform.system() != "Linux":
+        return None
+    syscall_numbers = {"x86_64": 202, "aarch64": 98}
+    number = syscall_numbers.get(platform.machine())
+    if number is None:
+        return None
+    try:
+        import ctypes
+        libc = ctypes.CDLL(None, use_errno=True)
+    except OSError:
+        return None
+    FUTEX_WAKE = 1
+
+    def wake(address):
+        libc.syscall(number, ctypes.c_void_p(address), FUTEX_WAKE, 0x7FFFFFFF, None, None, 0)
+    return wake
+
+
+class ShmRingWriter:
+    """Single writer; call publish() from one thread (the asyncio loop) only."""
+
+    def __init__(self, path, capacity=DEFAULT_CAPACITY):
+        capacity = max(capacity // 16 * 16, 4096)
+        size = DATA_OFFSET + capacity
+        # Reuse the file in place so a reader that already mapped it keeps seeing writes
+        fd = os.open(path, os.O_RDWR | os.O_CREAT, 0o600)
+        try:
+            os.ftruncate(fd, size)
+            self.mm = mmap.mmap(fd, size)
+        finally:
+            os.close(fd)
+
+        self.path = path
+        self.capacity = capacity
+        self.u32 = memoryview(self.mm).cast("I")
+        self.u64 = memoryview(self.mm).cast("Q")
+
+        # Readers skip the ring until the magic is there, so it goes in last
+        self.u32[0] = 0
+        struct.pack_into("<IQ", self.mm, 4, RING_VERSION, capacity)
+        self.write_pos = self.u64[WRITE_POS_OFFSET // 8]
+        self.u64[CLAIM_POS_OFFSET // 8] = self.write_pos
+        self.u32[0] = RING_MAGIC
+
+        self.wake = _futex_waker()
+        self.wake_word = None  # Keeps the buffer export (and so the address) alive
+        if self.wake:
+            import ctypes
+            self.wake_word = ctypes.c_uint32.from_buffer(self.mm, WAKE_SEQ_OFFSET)
+            self.wake_address = ctypes.addressof(self.wake_word)
+        logger.info(f"[ShmRing] Writing {path} ({capacity} bytes)")
+
+    def publish(self, topic: bytes, payload: bytes):
+        size = (RECORD_HEADER.size + len(topic) + len(payload) + 15) // 16 * 16
+        if size > self.capacity // 2:
+            logger.warning(f"[ShmRing] Dropping {len(payload)} byte message on {topic!r}: too large")
+            return
+
+        pos = self.write_pos
+        offset = pos % self.capacity
+        if self.capacity - offset < size:
+            # Records never wrap; pad out the tail and start over at offset 0
+            pad = self.capacity - offset
+            self.u64[CLAIM_POS_OFFSET // 8] = pos + pad
+            RECORD_HEADER.pack_into(self.mm, DATA_OFFSET + offset, pad, RECORD_PAD, 0, 0)
+            pos += pad
+            self.u64[WRITE_POS_OFFSET // 8] = pos
+            offset = 0
+
+        # Claim first, write, then publish: readers use claimPos to detect torn reads
+        self.u64[CLAIM_POS_OFFSET // 8] = pos + size
+        start = DATA_OFFSET + offset
+        RECORD_HEADER.pack_into(self.mm, start, size, RECORD_DATA, len(topic), len(payload))
+        body = start + RECORD_HEADER.size
+        self.mm[body:body + len(topic)] = topic
+        self.mm[body + len(topic):body + len(topic) + len(payload)] = payload
+        self.write_pos = pos + size
+        self.u64[WRITE_POS_OFFSET // 8] = self.write_pos
+
+        seq_index = WAKE_SEQ_OFFSET // 4
+        self.u32[seq_index] = (self.u32[seq_index] + 1) & 0xFFFFFFFF
+        if self.wake and self.u32[WAITERS_OFFSET // 4]:
+            self.wake(self.wake_address)
+
+    def close(self):
+        self.wake_word = None
+        self.u32.release()
+        self.u64.release()
+        self.mm.close()
+
+
+_rings = {}
+
+
+def shared_ring():
+    """Ring named by NIKTRADE_SHM_RING (inherited from the app), shared by every publisher."""
+    path = os.environ.get("NIKTRADE_SHM_RING")
+    if not path:
+        return None
+    if platform.machine().lower() not in X86_MACHINES:
+        logger.warning(f"[ShmRing] Ignoring NIKTRADE_SHM_RING on {platform.machine()}: the ring needs an x86 CPU")
+        return None
+    if path not in _rings:
+        _rings[path] = ShmRingWriter(path)
+    return _rings[path]
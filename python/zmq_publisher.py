@@ -2,6 +2,9 @@ import zmq
 from zmq.asyncio import Context, Socket
 import asyncio
 import logging
+import os
+
+from shm_ring import shared_ring
 
 logging.basicConfig(level=logging.INFO)
 logger = logging.getLogger(__name__)
@@ -34,8 +37,16 @@ class ZMQPublisher:
                     raise
                 asyncio.sleep(retry_delay)
 
+        # NIKTRADE_SHM_RING set: messages go to the shared-memory ring instead of the socket.
+        # The socket stays bound so the ports look the same to anything else.
+        self.ring = shared_ring()
+
     async def publish(self, topic: str, fb_bytes: bytes):
         """Send FlatBuffers bytes over ZeroMQ with topic prefix."""
+        if self.ring is not None:
+            self.ring.publish(topic.encode(), fb_bytes)
+            await asyncio.sleep(0)  # yield to event loop
+            return
         try:
             await self.socket.send_multipart([topic.encode(), fb_bytes])
             logger.debug(f"[ZMQPublisher] Published message on topic: {topic} ({len(fb_bytes)} bytes)")
@@ -48,3 +59,19 @@ class ZMQPublisher:
         if not self.socket.closed:
             self.socket.close(linger=0)
             logger.info(f"[ZMQPublisher] Closed socket at {self.endpoint}")
+
+
+async def signal_ready():
+    """
+    Readiness handshake: pushes "ready <pid>" to NIKTRADE_READY_ENDPOINT (set by the C++
+    PythonLauncher) once every socket is bound, so the app doesn't have to guess.
+    """
+    endpoint = os.environ.get("NIKTRADE_READY_ENDPOINT")
+    if not endpoint:
+        return
+    socket = Context.instance().socket(zmq.PUSH)
+    socket.setsockopt(zmq.LINGER, 1000)
+    socket.connect(endpoint)
+    await socket.send_string(f"ready {os.getpid()}")
+    socket.close()
+    logger.info(f"[ZMQPublisher] Signalled ready on {endpoint}")
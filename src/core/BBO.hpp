@@ -1,9 +1,10 @@
 #pragma once
 #include <string>
+#include "core/symbol_registry.hpp"
 
 // Normalized data-agnostic BBO (Best Bid and Offer) data structure
 struct BBO {
-    std::string symbol;
+    SymbolId symbol = kInvalidSymbolId;
     double bid_price;
     double bid_quantity;
     double ask_price;
@@ -3,9 +3,11 @@
 // Convert flatbuffers to BBO struct
 BBO decodeToBBO(
     const std::vector<uint8_t>& latestFlatbufferMessage,
+    SymbolId symbol,
     FileLogger& logger
 ) {
     BBO bbo;
+    bbo.symbol = symbol;
     if (!latestFlatbufferMessage.empty()) {
         logger.logInfo("Message successfully received for display.");
         const Binance::BookTicker* ticker = Binance::GetBookTicker(latestFlatbufferMessage.data());
@@ -15,8 +17,6 @@ BBO decodeToBBO(
                 try { return std::stod(s->str()); } catch (...) { return 0.0; }
             };
 
-            bbo.symbol = ticker->symbol() ? ticker->symbol()->str() : "[null]";
-            logger.logInfo(fmt::format("Displaying ticker for symbol: {}", bbo.symbol));
             bbo.bid_price = safe(ticker->best_bid());
             bbo.bid_quantity = safe(ticker->bid_qty());
             bbo.ask_price = safe(ticker->best_ask());
@@ -34,3 +34,30 @@ BBO decodeToBBO(
     }
     return bbo;
 }
+
+size_t decodeBookTickerBatch(
+    const std::vector<uint8_t>& payload,
+    const SymbolRegistry& symbols,
+    std::vector<BatchedQuote>& out
+) {
+    if (payload.empty()) return 0;
+    flatbuffers::Verifier verifier(payload.data(), payload.size());
+    if (!Binance::VerifyBookTickerBatchBuffer(verifier)) return 0;
+
+    const Binance::BookTickerBatch* batch = Binance::GetBookTickerBatch(payload.data());
+    if (batch->registry_hash() != symbols.fingerprint() || !batch->quotes()) return 0;
+
+    // Quotes are fixed-size structs: a straight walk over the vector, no per-quote lookups
+    size_t before = out.size();
+    for (const Binance::Quote* quote : *batch->quotes()) {
+        if (!symbols.contains(quote->symbol_id())) continue;
+        BatchedQuote& decoded = out.emplace_back();
+        decoded.bbo.symbol = quote->symbol_id();
+        decoded.bbo.bid_price = quote->bid_price();
+        decoded.bbo.bid_quantity = quote->bid_qty();
+        decoded.bbo.ask_price = quote->ask_price();
+        decoded.bbo.ask_quantity = quote->ask_qty();
+        decoded.receiveTimeNs = quote->receive_time_ns();
+    }
+    return out.size() - before;
+}
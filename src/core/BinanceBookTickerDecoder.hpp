@@ -6,9 +6,27 @@
 #include <cstdint>
 #include "utils/file_logger.hpp"
 #include "core/flatbuffers/Binance/binance_bookticker_generated.h"
+#include "core/flatbuffers/Binance/binance_bookticker_batch_generated.h"
 #include "core/BBO.hpp"
 
+// `symbol` is the registry id the payload arrived under (from its topic)
 BBO decodeToBBO(
     const std::vector<uint8_t>& latestCryptoMessage,
+    SymbolId symbol,
     FileLogger& logger
 );
+
+// One quote out of a BookTickerBatch frame
+struct BatchedQuote {
+    BBO bbo;
+    uint64_t receiveTimeNs = 0; // When the publisher received the update (epoch ns)
+};
+
+// Decode every quote of a BookTickerBatch in one pass, appending to `out`.
+// Returns the number appended; 0 for a malformed frame or one whose ids were
+// assigned from a different symbol list than `symbols`.
+size_t decodeBookTickerBatch(
+    const std::vector<uint8_t>& payload,
+    const SymbolRegistry& symbols,
+    std::vector<BatchedQuote>& out
+);
@@ -0,0 +1,34 @@
+#include "BinanceDepthDecoder.hpp"
+
+// Apply DepthUpdate flatbuffer to an OrderBook
+DepthApplyResult applyDepthMessage(
+    const std::vector<uint8_t>& depthMessage,
+    OrderBook& book
+) {
+    if (depthMessage.empty()) return DepthApplyResult::Invalid;
+
+    flatbuffers::Verifier verifier(depthMessage.data(), depthMessage.size());
+    if (!Binance::VerifyDepthUpdateBuffer(verifier)) return DepthApplyResult::Invalid;
+    const Binance::DepthUpdate* depth = Binance::GetDepthUpdate(depthMessage.data());
+
+    DepthApplyResult result = DepthApplyResult::Applied;
+    if (depth->is_snapshot()) {
+        book.beginSnapshot(depth->final_update_id());
+        result = DepthApplyResult::Snapshot;
+    } else {
+        switch (book.beginUpdate(depth->first_update_id(), depth->final_update_id())) {
+            case OrderBook::UpdateCheck::Apply:         break;
+            case OrderBook::UpdateCheck::Stale:         return DepthApplyResult::Stale;
+            case OrderBook::UpdateCheck::NeedsSnapshot: return DepthApplyResult::Buffer;
+            case OrderBook::UpdateCheck::Gap:           return DepthApplyResult::Gap;
+        }
+    }
+
+    if (auto bids = depth->bids()) {
+        for (const Binance::PriceLevel* level : *bids) book.setBid(level->price(), level->quantity());
+    }
+    if (auto asks = depth->asks()) {
+        for (const Binance::PriceLevel* level : *asks) book.setAsk(level->price(), level->quantity());
+    }
+    return result;
+}
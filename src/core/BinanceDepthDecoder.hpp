@@ -0,0 +1,22 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include "core/order_book.hpp"
+#include "core/flatbuffers/Binance/binance_depth_generated.h"
+
+// Outcome of feeding one depth.<symbol> payload into a book
+enum class DepthApplyResult {
+    Snapshot, // Book replaced by a snapshot
+    Applied,  // Diff applied
+    Stale,    // Diff older than the book; ignored
+    Buffer,   // Book has no snapshot yet; caller should keep the payload
+    Gap,      // Update ids skipped; book is OutOfSync until the next snapshot
+    Invalid   // Not a valid DepthUpdate buffer
+};
+
+// Apply a Binance::DepthUpdate flatbuffer (snapshot or diff) to `book`.
+// Levels are read straight out of the buffer; nothing is allocated.
+DepthApplyResult applyDepthMessage(
+    const std::vector<uint8_t>& depthMessage,
+    OrderBook& book
+);
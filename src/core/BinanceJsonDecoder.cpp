@@ -0,0 +1,219 @@
+#include "BinanceJsonDecoder.hpp"
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+
+// Walks the members of one JSON object. Values come back as raw slices: strings
+// without their quotes (escapes left as-is; Binance never sends any in these
+// fields), objects/arrays/numbers/literals verbatim.
+class JsonObjectReader {
+public:
+    explicit JsonObjectReader(std::string_view json) : json_(json) {
+        skipSpace();
+        ok_ = pos_ < json_.size() && json_[pos_] == '{';
+        ++pos_;
+    }
+
+    bool ok() const { return ok_; }
+
+    bool next(std::string_view& key, std::string_view& value) {
+        if (!ok_) return false;
+        skipSpace();
+        if (pos_ < json_.size() && json_[pos_] == ',') { ++pos_; skipSpace(); }
+        if (pos_ >= json_.size()) return fail(); // Truncated
+        if (json_[pos_] == '}') return false;
+
+        if (!readString(key)) return fail();
+        skipSpace();
+        if (pos_ >= json_.size() || json_[pos_] != ':') return fail();
+        ++pos_;
+        skipSpace();
+        if (pos_ < json_.size() && json_[pos_] == '"') return readString(value) || fail();
+
+        size_t start = pos_;
+        if (!skipValue() || pos_ == start) return fail();
+        value = json_.substr(start, pos_ - start);
+        return true;
+    }
+
+private:
+    bool fail() { ok_ = false; return false; }
+
+    void skipSpace() {
+        while (pos_ < json_.size() && (json_[pos_] == ' ' || json_[pos_] == '\n' ||
+                                       json_[pos_] == '\r' || json_[pos_] == '\t')) ++pos_;
+    }
+
+    bool readString(std::string_view& out) {
+        if (pos_ >= json_.size() || json_[pos_] != '"') return false;
+        size_t start = ++pos_;
+        while (pos_ < json_.size() && json_[pos_] != '"') pos_ += json_[pos_] == '\\' ? 2 : 1;
+        if (pos_ >= json_.size()) return false;
+        out = json_.substr(start, pos_ - start);
+        ++pos_;
+        return true;
+    }
+
+    // Scalar, or a nested object/array skipped by bracket depth
+    bool skipValue() {
+        int depth = 0;
+        while (pos_ < json_.size()) {
+            char c = json_[pos_];
+            if (c == '"') {
+                std::string_view ignored;
+                if (!readString(ignored)) return false;
+                if (depth == 0) return true;
+                continue;
+            }
+            if (c == '{' || c == '[') depth++;
+            else if (c == '}' || c == ']') {
+                if (depth == 0) return true; // End of the enclosing object
+                if (--depth == 0) { ++pos_; return true; }
+            } else if (c == ',' && depth == 0) {
+                return true;
+            }
+            ++pos_;
+        }
+        return depth == 0;
+    }
+
+    std::string_view json_;
+    size_t pos_ = 0;
+    bool ok_ = false;
+};
+
+bool parseDouble(std::string_view text, double& out) {
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    auto result = std::from_chars(text.data(), text.data() + text.size(), out);
+    return result.ec == std::errc{};
+#else
+    // No floating-point from_chars on this standard library
+    char buf[64];
+    if (text.empty() || text.size() >= sizeof(buf)) return false;
+    std::memcpy(buf, text.data(), text.size());
+    buf[text.size()] = '\0';
+    char* end = nullptr;
+    out = std::strtod(buf, &end);
+    return end == buf + text.size();
+#endif
+}
+
+bool parseUint(std::string_view text, uint64_t& out) {
+    auto result = std::from_chars(text.data(), text.data() + text.size(), out);
+    return result.ec == std::errc{};
+}
+
+// Binance sends upper-case symbols ("BTCUSDT") but the registry holds the lower-case
+// names of binance_symbols.json (the stream names use them too)
+bool resolveSymbol(std::string_view name, const SymbolRegistry& symbols, SymbolId& out) {
+    out = kInvalidSymbolId;
+    char lower[32];
+    if (name.size() > sizeof(lower)) return false;
+    for (size_t i = 0; i < name.size(); ++i) {
+        char c = name[i];
+        lower[i] = (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+    }
+    out = symbols.find(std::string_view(lower, name.size()));
+    return out != kInvalidSymbolId;
+}
+
+} // namespace
+
+BinanceJsonEvent classifyBinanceJson(std::string_view message, std::string_view& data) {
+    JsonObjectReader reader(message);
+    if (!reader.ok()) return BinanceJsonEvent::Invalid;
+
+    std::string_view key, value, stream, eventType;
+    bool hasBookTickerFields = false;
+    data = message;
+    while (reader.next(key, value)) {
+        if (key == "stream") stream = value;
+        else if (key == "data") data = value;
+        else if (key == "e") eventType = value;
+        else if (key == "u") hasBookTickerFields = true; // Only bookTicker has no "e"
+    }
+    if (!reader.ok()) return BinanceJsonEvent::Invalid;
+
+    if (!stream.empty()) {
+        size_t at = stream.find('@');
+        std::string_view kind = at == std::string_view::npos ? std::string_view{} : stream.substr(at + 1);
+        if (kind == "bookTicker") return BinanceJsonEvent::BookTicker;
+        if (kind.substr(0, 6) == "kline_") return BinanceJsonEvent::Kline;
+        if (kind == "trade") return BinanceJsonEvent::Trade;
+        return BinanceJsonEvent::Other;
+    }
+    if (eventType == "kline") return BinanceJsonEvent::Kline;
+    if (eventType == "trade") return BinanceJsonEvent::Trade;
+    if (eventType.empty() && hasBookTickerFields) return BinanceJsonEvent::BookTicker;
+    return BinanceJsonEvent::Other;
+}
+
+// {"u":400900217,"s":"BNBUSDT","b":"25.35190000","B":"31.21000000","a":"25.36520000","A":"40.66000000"}
+bool decodeBookTickerJson(std::string_view data, const SymbolRegistry& symbols, BBO& out) {
+    JsonObjectReader reader(data);
+    std::string_view key, value;
+    unsigned seen = 0;
+    while (reader.next(key, value)) {
+        if (key.size() != 1) continue;
+        switch (key[0]) {
+            case 's': if (resolveSymbol(value, symbols, out.symbol)) seen |= 1; break;
+            case 'b': if (parseDouble(value, out.bid_price)) seen |= 2; break;
+            case 'B': if (parseDouble(value, out.bid_quantity)) seen |= 4; break;
+            case 'a': if (parseDouble(value, out.ask_price)) seen |= 8; break;
+            case 'A': if (parseDouble(value, out.ask_quantity)) seen |= 16; break;
+        }
+    }
+    out.error.clear();
+    return reader.ok() && seen == 31;
+}
+
+// {"e":"kline","E":..,"s":"BNBBTC","k":{"t":..,"T":..,"o":"..","c":"..","h":"..","l":"..","v":"..","x":false,...}}
+bool decodeKlineJson(std::string_view data, const SymbolRegistry& symbols, SymbolId& symbol, KlineData& out,
+                     bool& closed) {
+    JsonObjectReader reader(data);
+    std::string_view key, value, kline;
+    bool hasSymbol = false;
+    while (reader.next(key, value)) {
+        if (key == "s") hasSymbol = resolveSymbol(value, symbols, symbol);
+        else if (key == "k") kline = value;
+    }
+    if (!reader.ok() || !hasSymbol || kline.empty()) return false;
+
+    JsonObjectReader candle(kline);
+    unsigned seen = 0;
+    closed = false;
+    while (candle.next(key, value)) {
+        if (key.size() != 1) continue;
+        switch (key[0]) {
+            case 't': if (parseUint(value, out.open_time)) seen |= 1; break;
+            case 'T': if (parseUint(value, out.close_time)) seen |= 2; break;
+            case 'o': if (parseDouble(value, out.open)) seen |= 4; break;
+            case 'h': if (parseDouble(value, out.high)) seen |= 8; break;
+            case 'l': if (parseDouble(value, out.low)) seen |= 16; break;
+            case 'c': if (parseDouble(value, out.close)) seen |= 32; break;
+            case 'v': if (parseDouble(value, out.volume)) seen |= 64; break;
+            case 'x': closed = value == "true"; break;
+        }
+    }
+    return candle.ok() && seen == 127;
+}
+
+// {"e":"trade","E":..,"s":"BNBBTC","t":12345,"p":"0.001","q":"100","T":123456785,"m":true,"M":true}
+bool decodeTradeJson(std::string_view data, const SymbolRegistry& symbols, SymbolId& symbol, TradeData& out) {
+    JsonObjectReader reader(data);
+    std::string_view key, value;
+    unsigned seen = 0;
+    while (reader.next(key, value)) {
+        if (key.size() != 1) continue;
+        switch (key[0]) {
+            case 's': if (resolveSymbol(value, symbols, symbol)) seen |= 1; break;
+            case 'p': if (parseDouble(value, out.price)) seen |= 2; break;
+            case 'q': if (parseDouble(value, out.quantity)) seen |= 4; break;
+            case 'T': if (parseUint(value, out.trade_time)) seen |= 8; break;
+            case 'm': out.is_buyer_maker = value == "true"; seen |= 16; break;
+        }
+    }
+    return reader.ok() && seen == 31;
+}
@@ -0,0 +1,32 @@
+#pragma once
+#include <string_view>
+#include "core/BBO.hpp"
+#include "core/binance_kline.hpp"
+#include "core/trade.hpp"
+#include "core/symbol_registry.hpp"
+
+// Decoders for raw Binance websocket JSON, used by the in-process feed handler.
+// They scan the text once without building a DOM or allocating, and convert the
+// decimal strings straight to doubles.
+
+// Event kinds carried by a websocket message
+enum class BinanceJsonEvent {
+    BookTicker,
+    Kline,
+    Trade,
+    Other,  // Subscription replies ({"result":...,"id":...}) and unknown streams
+    Invalid // Not a JSON object
+};
+
+// Classify one message. Accepts both combined-stream envelopes
+// ({"stream":"btcusdt@bookTicker","data":{...}}) and bare events; `data` is set
+// to the event object itself.
+BinanceJsonEvent classifyBinanceJson(std::string_view message, std::string_view& data);
+
+// Each returns false (leaving `out` partially written) when a required field is
+// missing or the symbol is not in the registry
+bool decodeBookTickerJson(std::string_view data, const SymbolRegistry& symbols, BBO& out);
+// `closed` is the kline's final flag ("x"), false when absent
+bool decodeKlineJson(std::string_view data, const SymbolRegistry& symbols, SymbolId& symbol, KlineData& out,
+                     bool& closed);
+bool decodeTradeJson(std::string_view data, const SymbolRegistry& symbols, SymbolId& symbol, TradeData& out);
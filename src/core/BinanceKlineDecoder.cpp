@@ -0,0 +1,38 @@
+#include "BinanceKlineDecoder.hpp"
+#include <string>
+
+// Convert Klines flatbuffer to KlineData structs
+size_t decodeToKlines(
+    const std::vector<uint8_t>& klinesMessage,
+    std::vector<KlineData>& out,
+    size_t* closedCount
+) {
+    if (closedCount) *closedCount = 0;
+    if (klinesMessage.empty()) return 0;
+
+    const Binance::Klines* fb_klines = Binance::GetKlines(klinesMessage.data());
+    if (!fb_klines || !fb_klines->klines()) return 0;
+
+    auto safe = [](const flatbuffers::String* s) -> double {
+        if (!s || s->size() == 0) return 0.0;
+        try { return std::stod(s->str()); } catch (...) { return 0.0; }
+    };
+
+    size_t appended = 0;
+    size_t closed = 0;
+    for (auto kl : *(fb_klines->klines())) {
+        KlineData k;
+        k.open_time  = kl->open_time();
+        k.open       = safe(kl->open_price());
+        k.high       = safe(kl->high_price());
+        k.low        = safe(kl->low_price());
+        k.close      = safe(kl->close_price());
+        k.volume     = safe(kl->volume());
+        k.close_time = kl->close_time();
+        out.push_back(k);
+        if (kl->is_closed() && closed == appended) ++closed;
+        ++appended;
+    }
+    if (closedCount) *closedCount = closed;
+    return appended;
+}
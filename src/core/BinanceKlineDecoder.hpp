@@ -0,0 +1,15 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include "core/binance_kline.hpp"
+#include "core/flatbuffers/Binance/binance_kline_generated.h"
+
+// Decode a Binance::Klines flatbuffer and append every candle to `out`.
+// Returns the number of candles appended (0 on empty/invalid buffers).
+// `closedCount`, if given, receives how many of them, counted from the first, the
+// message marks final; a candle that is still forming can only come last.
+size_t decodeToKlines(
+    const std::vector<uint8_t>& klinesMessage,
+    std::vector<KlineData>& out,
+    size_t* closedCount = nullptr
+);
@@ -0,0 +1,19 @@
+#include "BinanceTradeDecoder.hpp"
+
+// Convert Trade flatbuffer to TradeData struct
+bool decodeToTrade(
+    const std::vector<uint8_t>& tradeMessage,
+    TradeData& out
+) {
+    if (tradeMessage.empty()) return false;
+
+    flatbuffers::Verifier verifier(tradeMessage.data(), tradeMessage.size());
+    if (!Binance::VerifyTradeBuffer(verifier)) return false;
+    const Binance::Trade* trade = Binance::GetTrade(tradeMessage.data());
+
+    out.trade_time     = trade->trade_time();
+    out.price          = trade->price();
+    out.quantity       = trade->quantity();
+    out.is_buyer_maker = trade->is_buyer_maker();
+    return true;
+}
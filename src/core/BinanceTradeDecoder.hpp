@@ -0,0 +1,12 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include "core/trade.hpp"
+#include "core/flatbuffers/Binance/binance_trade_generated.h"
+
+// Decode a Binance::Trade flatbuffer into `out`.
+// Returns false (leaving `out` untouched) on empty/invalid buffers.
+bool decodeToTrade(
+    const std::vector<uint8_t>& tradeMessage,
+    TradeData& out
+);
@@ -1,5 +1,6 @@
 #include "core/backtest_engines/macd_vwapBacktester.hpp"
 #include <fmt/core.h>
+#include <cmath> // for std::floor
 
 // As of now, focus on:
 // - Total PnL
@@ -22,7 +23,7 @@ bool bullishMACDSignal (MACDResult& macd_values, size_t macd_current_index) {
     }
 }
 
-bool bullishVWAPSignal (std::vector<double>& vwap_values, std::vector<Tick>& ticker_data, size_t iteration) {
+bool bullishVWAPSignal (std::vector<double>& vwap_values, std::span<const Tick> ticker_data, size_t iteration) {
     // compare hte previous day's values to current day's values
     // to determine if there is a bullish sign:
     if (ticker_data[iteration - 1].close <= vwap_values[iteration - 1]
@@ -47,7 +48,7 @@ bool bearishMACDSignal (MACDResult& macd_values, size_t macd_current_index) {
     }
 }
 
-bool bearishVWAPSignal (std::vector<double>& vwap_values, std::vector<Tick>& ticker_data, size_t iteration) {
+bool bearishVWAPSignal (std::vector<double>& vwap_values, std::span<const Tick> ticker_data, size_t iteration) {
     // compare hte previous day's values to current day's values
     // to determine if there is a bearish sign:
     if (ticker_data[iteration - 1].close >= vwap_values[iteration - 1]
@@ -60,7 +61,7 @@ bool bearishVWAPSignal (std::vector<double>& vwap_values, std::vector<Tick>& tic
 
 
 std::vector<Trade> MACD_VWAPBacktestResultCalc (int& fastEMAPeriod, int& slowEMAPeriod, int& signalPeriod
-    , double starting_capital, std::vector<Tick>& tickerData) {
+    , double starting_capital, std::span<const Tick> tickerData) {
     std::vector<Trade> macd_vwap_backtest_result;
     // test edge cases:
     if (fastEMAPeriod > slowEMAPeriod) {
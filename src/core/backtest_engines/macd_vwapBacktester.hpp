@@ -4,4 +4,4 @@
 #include "core/backtest_engines/Trade.hpp"
 
 std::vector<Trade> MACD_VWAPBacktestResultCalc (int& fastEMAPeriod, int& slowEMAPeriod, int& signalPeriod
-    , double starting_capital, std::vector<Tick>& tickerData);
\ No newline at end of file
+    , double starting_capital, std::span<const Tick> tickerData);
\ No newline at end of file
@@ -13,7 +13,7 @@
     Sell Signal: When the fast SMA crosses BELOW the slow SMA
     (indicates potential downward trend)
 */
-std::vector<Trade> sma_crossover_result(int& fastSMAPeriod, int& slowSMAPeriod, double& startingCapital, std::vector<Tick>& ticker_data) {
+std::vector<Trade> sma_crossover_result(int& fastSMAPeriod, int& slowSMAPeriod, double& startingCapital, std::span<const Tick> ticker_data) {
     std::vector<Trade> sma_crossover_trades;
 
     // Make sure fast SMA period is smaller than slow SMA period
@@ -2,4 +2,4 @@
 #include "core/tech_indicators/sma.hpp"
 #include "Trade.hpp"
 
-std::vector<Trade> sma_crossover_result(int& fastSMAPeriod, int& slowSMAPeriod, double& startingCapital, std::vector<Tick>& ticker_data);
+std::vector<Trade> sma_crossover_result(int& fastSMAPeriod, int& slowSMAPeriod, double& startingCapital, std::span<const Tick> ticker_data);
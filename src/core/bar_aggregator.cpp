@@ -0,0 +1,92 @@
+#include "bar_aggregator.hpp"
+#include <algorithm>
+
+BarAggregator::BarAggregator(uint64_t intervalMs, size_t maxBars)
+    : intervalMs_(intervalMs),
+      maxBars_(maxBars),
+      bars_(maxBars)
+{
+}
+
+bool BarAggregator::store(const KlineData& bar) {
+    CandleChange change = bars_.upsert(bar);
+    pendingChange_.merge(change);
+    return change.changed();
+}
+
+CandleChange BarAggregator::takeChange() {
+    CandleChange change = pendingChange_;
+    pendingChange_ = CandleChange{};
+    return change;
+}
+
+void BarAggregator::openBar(uint64_t openTime, double price) {
+    store(KlineData{openTime, price, price, price, price, 0.0, openTime + intervalMs_ - 1});
+}
+
+bool BarAggregator::mergeBars(const std::vector<KlineData>& klines) {
+    bool changed = false;
+    for (const KlineData& k : klines) {
+        // Bars coarser than ours (or not dividing it) cannot be split into our buckets
+        uint64_t span = k.close_time - k.open_time + 1;
+        if (k.close_time < k.open_time || span > intervalMs_ || intervalMs_ % span != 0) continue;
+
+        uint64_t open = bucketOpen(k.open_time);
+        bool newBucket = bars_.empty() || open > bars_.back().open_time;
+        if (newBucket && !bars_.empty()) advanceTo(open); // Keep the series gap-free
+
+        if (span == intervalMs_) {
+            // Same interval: the exchange's bar replaces whatever we hold for that open_time
+            changed |= store(KlineData{open, k.open, k.high, k.low, k.close, k.volume, open + intervalMs_ - 1});
+        } else if (newBucket || (open == bars_.back().open_time && k.open_time > lastRolledUpOpen_)) {
+            // Next finer bar of the forming bucket (the first one opens it)
+            KlineData bar = newBucket ? KlineData{open, k.open, k.high, k.low, k.close, 0.0, open + intervalMs_ - 1}
+                                      : bars_.back();
+            bar.high = std::max(bar.high, k.high);
+            bar.low = std::min(bar.low, k.low);
+            bar.close = k.close;
+            bar.volume += k.volume;
+            lastRolledUpOpen_ = k.open_time;
+            changed |= store(bar);
+        }
+    }
+    return changed;
+}
+
+bool BarAggregator::addTrade(uint64_t tradeTimeMs, double price, double quantity) {
+    uint64_t open = bucketOpen(tradeTimeMs);
+    if (bars_.empty()) openBar(open, price);
+    else if (open > bars_.back().open_time) advanceTo(tradeTimeMs);
+
+    // Almost always the forming bar; late trades patch the bar they belong to
+    const KlineData* existing = bars_.find(open);
+    if (!existing) return false; // Older than anything held
+
+    KlineData bar = *existing;
+    bool forming = open == bars_.back().open_time;
+    if (bar.volume == 0.0) {
+        // First trade of a bar opened by time: it sets the open, not the previous close
+        bar.open = bar.high = bar.low = bar.close = price;
+    } else {
+        bar.high = std::max(bar.high, price);
+        bar.low = std::min(bar.low, price);
+        if (forming) bar.close = price;
+    }
+    bar.volume += quantity;
+    return store(bar);
+}
+
+bool BarAggregator::advanceTo(uint64_t nowMs) {
+    if (bars_.empty()) return false;
+
+    uint64_t bucket = bucketOpen(nowMs);
+    uint64_t next = bars_.back().open_time + intervalMs_;
+    if (next > bucket) return false;
+
+    // A long silence only needs the last maxBars_ flat bars
+    if ((bucket - next) / intervalMs_ >= maxBars_) next = bucket - (maxBars_ - 1) * intervalMs_;
+
+    double close = bars_.back().close;
+    for (; next <= bucket; next += intervalMs_) openBar(next, close);
+    return true;
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+#include "core/binance_kline.hpp"
+#include "core/candle_store.hpp"
+
+// Builds OHLCV bars of one interval incrementally from trades.
+// Bars are aligned to interval boundaries like exchange klines; the last bar is the
+// forming one and is updated in place until time moves past its close.
+class BarAggregator {
+public:
+    explicit BarAggregator(uint64_t intervalMs, size_t maxBars = 500);
+
+    // Merge exchange klines (ascending): a REST backfill or pushed kline updates.
+    // Bars of this interval are authoritative and replace the bar with the same open_time.
+    // Finer bars that divide the interval are rolled up, each one only once (their later
+    // updates are covered by the trades). Returns true if any bar changed.
+    bool mergeBars(const std::vector<KlineData>& klines);
+
+    // Returns true if a bar changed. A late trade patches the bar it belongs to.
+    bool addTrade(uint64_t tradeTimeMs, double price, double quantity);
+
+    // Close bars whose interval has elapsed by `nowMs`; intervals without trades get a
+    // flat zero-volume bar at the previous close. Returns true if a bar was opened.
+    bool advanceTo(uint64_t nowMs);
+
+    const std::deque<KlineData>& bars() const { return bars_.candles(); }
+    uint64_t intervalMs() const { return intervalMs_; }
+
+    // Everything changed since the last call (lets consumers redo only the changed suffix)
+    CandleChange takeChange();
+
+private:
+    uint64_t bucketOpen(uint64_t timeMs) const { return timeMs - timeMs % intervalMs_; }
+    void openBar(uint64_t openTime, double price);
+    bool store(const KlineData& bar); // Upsert + record the change
+
+    uint64_t intervalMs_;
+    size_t maxBars_;
+    CandleStore bars_;
+    CandleChange pendingChange_;
+    uint64_t lastRolledUpOpen_ = 0; // open_time of the newest finer bar already rolled up
+};
@@ -0,0 +1,44 @@
+#include "bar_series.hpp"
+#include <algorithm>
+
+bool BarSeries::applyChange(const std::deque<KlineData>& source, const CandleChange& change) {
+    if (!change.changed()) return false;
+
+    // Trimmed bars only move the offset; chunks that fall out entirely are released
+    size_t trimmed = std::min(change.trimmed, size_);
+    offset_ += trimmed;
+    size_ -= trimmed;
+    size_t dropped = std::min(offset_ / kChunkBars, chunks_.size());
+    chunks_.erase(chunks_.begin(), chunks_.begin() + dropped);
+    offset_ -= dropped * kChunkBars;
+
+    // Cut back to the first changed bar; a chunk that is cut into is copied, not edited
+    size_t first = std::min(change.first, source.size());
+    size_ = std::min(size_, first);
+    size_t end = offset_ + size_;
+    chunks_.resize((end + kChunkBars - 1) / kChunkBars);
+    Chunk tail;
+    if (end % kChunkBars != 0) {
+        const Chunk& last = *chunks_.back();
+        tail.assign(last.begin(), last.begin() + end % kChunkBars);
+        chunks_.pop_back();
+    }
+
+    // Append the changed suffix, sealing each chunk as it fills
+    tail.reserve(kChunkBars);
+    for (size_t i = first; i < source.size(); ++i) {
+        tail.push_back(source[i]);
+        if (tail.size() == kChunkBars) {
+            chunks_.push_back(std::make_shared<const Chunk>(std::move(tail)));
+            tail = Chunk();
+            tail.reserve(kChunkBars);
+        }
+    }
+    if (!tail.empty()) chunks_.push_back(std::make_shared<const Chunk>(std::move(tail)));
+    size_ += source.size() - first;
+    if (size_ == 0) {
+        chunks_.clear();
+        offset_ = 0;
+    }
+    return true;
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <vector>
+#include "core/binance_kline.hpp"
+#include "core/candle_store.hpp"
+
+// Bars of one timeframe as published in a snapshot, oldest first. The bars sit in
+// fixed-size chunks that copies of the series share; changing the newest bars copies
+// only the chunk(s) holding them, so publishing a series after the forming bar moved
+// costs one chunk, not the whole history. Copying a series copies the chunk pointers.
+class BarSeries {
+public:
+    static constexpr size_t kChunkBars = 256;
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    const KlineData& operator[](size_t i) const {
+        i += offset_;
+        return (*chunks_[i / kChunkBars])[i % kChunkBars];
+    }
+
+    // Bring in line with `source` given the change since they were last equal.
+    // Chunks other copies still hold are never modified. False if nothing changed.
+    bool applyChange(const std::deque<KlineData>& source, const CandleChange& change);
+
+private:
+    using Chunk = std::vector<KlineData>; // Full except for the last one
+
+    std::vector<std::shared_ptr<const Chunk>> chunks_;
+    size_t offset_ = 0; // Bars trimmed off the front of chunks_.front()
+    size_t size_ = 0;
+};
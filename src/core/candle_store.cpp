@@ -0,0 +1,82 @@
+#include "candle_store.hpp"
+#include <algorithm>
+
+namespace {
+
+bool sameCandle(const KlineData& a, const KlineData& b) {
+    return a.open_time == b.open_time && a.close_time == b.close_time &&
+           a.open == b.open && a.high == b.high && a.low == b.low &&
+           a.close == b.close && a.volume == b.volume;
+}
+
+bool openedBefore(const KlineData& a, const KlineData& b) {
+    return a.open_time < b.open_time;
+}
+
+} // namespace
+
+void CandleChange::merge(const CandleChange& later) {
+    if (first != npos) first = first > later.trimmed ? first - later.trimmed : 0;
+    first = std::min(first, later.first);
+    trimmed += later.trimmed;
+}
+
+CandleStore::CandleStore(size_t maxCandles)
+    : maxCandles_(maxCandles)
+{
+}
+
+CandleChange CandleStore::upsert(const KlineData& candle) {
+    CandleChange change;
+    if (candles_.empty() || candle.open_time > candles_.back().open_time) {
+        // Next candle: the common live case
+        candles_.push_back(candle);
+        change.first = candles_.size() - 1;
+    } else {
+        size_t index = candles_.size() - 1;
+        if (candle.open_time != candles_.back().open_time) {
+            auto it = std::lower_bound(candles_.begin(), candles_.end(), candle, openedBefore);
+            index = static_cast<size_t>(it - candles_.begin());
+        }
+
+        if (candles_[index].open_time == candle.open_time) {
+            if (sameCandle(candles_[index], candle)) return change; // Duplicate: nothing to redo
+            candles_[index] = candle;
+        } else {
+            // A hole in the history; older than everything a full store keeps is dropped
+            if (index == 0 && candles_.size() >= maxCandles_) return change;
+            candles_.insert(candles_.begin() + index, candle);
+        }
+        change.first = index;
+    }
+
+    if (candles_.size() > maxCandles_) {
+        candles_.pop_front();
+        change.trimmed = 1;
+        change.first = change.first > 0 ? change.first - 1 : 0;
+    }
+    return change;
+}
+
+CandleChange CandleStore::upsert(const std::vector<KlineData>& batch) {
+    const std::vector<KlineData>* ordered = &batch;
+    if (!std::is_sorted(batch.begin(), batch.end(), openedBefore)) {
+        sortScratch_.assign(batch.begin(), batch.end());
+        std::stable_sort(sortScratch_.begin(), sortScratch_.end(), openedBefore);
+        ordered = &sortScratch_;
+    }
+
+    CandleChange change;
+    for (const KlineData& candle : *ordered) change.merge(upsert(candle));
+    return change;
+}
+
+const KlineData* CandleStore::find(uint64_t openTime) const {
+    if (candles_.empty()) return nullptr;
+    if (candles_.back().open_time == openTime) return &candles_.back();
+
+    KlineData key{};
+    key.open_time = openTime;
+    auto it = std::lower_bound(candles_.begin(), candles_.end(), key, openedBefore);
+    return it != candles_.end() && it->open_time == openTime ? &*it : nullptr;
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+#include "core/binance_kline.hpp"
+
+// What one or more upserts did to a CandleStore. Indices refer to the store afterwards.
+struct CandleChange {
+    static constexpr size_t npos = static_cast<size_t>(-1);
+    size_t first = npos; // Oldest changed index; candles from here to the end may differ
+    size_t trimmed = 0;  // Candles dropped from the front (cached indices shift down by this)
+
+    bool changed() const { return first != npos || trimmed != 0; }
+    // Fold in a change that happened after this one
+    void merge(const CandleChange& later);
+};
+
+// Candles ordered by open_time, at most one per open_time, capped at maxCandles (oldest dropped).
+// Upserting the last candle or appending a new one is O(1); older candles are located by
+// binary search, so re-sent or out-of-order history updates in place instead of duplicating.
+class CandleStore {
+public:
+    explicit CandleStore(size_t maxCandles = 500);
+
+    CandleChange upsert(const KlineData& candle);
+    // Batch in any order; on duplicate open_times the later entry wins
+    CandleChange upsert(const std::vector<KlineData>& batch);
+
+    // nullptr when no candle opens at `openTime`
+    const KlineData* find(uint64_t openTime) const;
+
+    const std::deque<KlineData>& candles() const { return candles_; }
+    const KlineData& back() const { return candles_.back(); }
+    size_t size() const { return candles_.size(); }
+    bool empty() const { return candles_.empty(); }
+
+private:
+    std::deque<KlineData> candles_;
+    size_t maxCandles_;
+    std::vector<KlineData> sortScratch_; // Reused for unsorted batches
+};
@@ -0,0 +1,99 @@
+# automatically generated by the FlatBuffers compiler, do not modify
+
+# namespace: Binance
+
+import flatbuffers
+from flatbuffers.compat import import_numpy
+np = import_numpy()
+
+class BookTickerBatch(object):
+    __slots__ = ['_tab']
+
+    @classmethod
+    def GetRootAs(cls, buf, offset=0):
+        n = flatbuffers.encode.Get(flatbuffers.packer.uoffset, buf, offset)
+        x = BookTickerBatch()
+        x.Init(buf, n + offset)
+        return x
+
+    @classmethod
+    def GetRootAsBookTickerBatch(cls, buf, offset=0):
+        """This method is deprecated. Please switch to GetRootAs."""
+        return cls.GetRootAs(buf, offset)
+    # BookTickerBatch
+    def Init(self, buf, pos):
+        self._tab = flatbuffers.table.Table(buf, pos)
+
+    # BookTickerBatch
+    def Quotes(self, j):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(4))
+        if o != 0:
+            x = self._tab.Vector(o)
+            x += flatbuffers.number_types.UOffsetTFlags.py_type(j) * 56
+            from Binance.Quote import Quote
+            obj = Quote()
+            obj.Init(self._tab.Bytes, x)
+            return obj
+        return None
+
+    # BookTickerBatch
+    def QuotesLength(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(4))
+        if o != 0:
+            return self._tab.VectorLen(o)
+        return 0
+
+    # BookTickerBatch
+    def QuotesIsNone(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(4))
+        return o == 0
+
+    # BookTickerBatch
+    def PublishTimeNs(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(6))
+        if o != 0:
+            return self._tab.Get(flatbuffers.number_types.Uint64Flags, o + self._tab.Pos)
+        return 0
+
+    # BookTickerBatch
+    def RegistryHash(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(8))
+        if o != 0:
+            return self._tab.Get(flatbuffers.number_types.Uint64Flags, o + self._tab.Pos)
+        return 0
+
+def BookTickerBatchStart(builder):
+    builder.StartObject(3)
+
+def Start(builder):
+    BookTickerBatchStart(builder)
+
+def BookTickerBatchAddQuotes(builder, quotes):
+    builder.PrependUOffsetTRelativeSlot(0, flatbuffers.number_types.UOffsetTFlags.py_type(quotes), 0)
+
+def AddQuotes(builder, quotes):
+    BookTickerBatchAddQuotes(builder, quotes)
+
+def BookTickerBatchStartQuotesVector(builder, numElems):
+    return builder.StartVector(56, numElems, 8)
+
+def StartQuotesVector(builder, numElems):
+    return BookTickerBatchStartQuotesVector(builder, numElems)
+
+def BookTickerBatchAddPublishTimeNs(builder, publishTimeNs):
+    builder.PrependUint64Slot(1, publishTimeNs, 0)
+
+def AddPublishTimeNs(builder, publishTimeNs):
+    BookTickerBatchAddPublishTimeNs(builder, publishTimeNs)
+
+def BookTickerBatchAddRegistryHash(builder, registryHash):
+    builder.PrependUint64Slot(2, registryHash, 0)
+
+def AddRegistryHash(builder, registryHash):
+    BookTickerBatchAddRegistryHash(builder, registryHash)
+
+def BookTickerBatchEnd(builder):
+    return builder.EndObject()
+
+def End(builder):
+    return BookTickerBatchEnd(builder)
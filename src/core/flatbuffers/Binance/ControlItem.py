@@ -0,0 +1,93 @@
+# automatically generated by the FlatBuffers compiler, do not modify
+
+# namespace: Binance
+
+import flatbuffers
+from flatbuffers.compat import import_numpy
+np = import_numpy()
+
+class ControlItem(object):
+    __slots__ = ['_tab']
+
+    @classmethod
+    def GetRootAs(cls, buf, offset=0):
+        n = flatbuffers.encode.Get(flatbuffers.packer.uoffset, buf, offset)
+        x = ControlItem()
+        x.Init(buf, n + offset)
+        return x
+
+    @classmethod
+    def GetRootAsControlItem(cls, buf, offset=0):
+        """This method is deprecated. Please switch to GetRootAs."""
+        return cls.GetRootAs(buf, offset)
+    @classmethod
+    def ControlItemBufferHasIdentifier(cls, buf, offset, size_prefixed=False):
+        return flatbuffers.util.BufferHasIdentifier(buf, offset, b"\x4E\x4B\x43\x54", size_prefixed=size_prefixed)
+
+    # ControlItem
+    def Init(self, buf, pos):
+        self._tab = flatbuffers.table.Table(buf, pos)
+
+    # ControlItem
+    def Op(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(4))
+        if o != 0:
+            return self._tab.Get(flatbuffers.number_types.Uint8Flags, o + self._tab.Pos)
+        return 0
+
+    # ControlItem
+    def Symbol(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(6))
+        if o != 0:
+            return self._tab.String(o + self._tab.Pos)
+        return None
+
+    # ControlItem
+    def StartTime(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(8))
+        if o != 0:
+            return self._tab.Get(flatbuffers.number_types.Uint64Flags, o + self._tab.Pos)
+        return 0
+
+    # ControlItem
+    def EndTime(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(10))
+        if o != 0:
+            return self._tab.Get(flatbuffers.number_types.Uint64Flags, o + self._tab.Pos)
+        return 0
+
+def ControlItemStart(builder):
+    builder.StartObject(4)
+
+def Start(builder):
+    ControlItemStart(builder)
+
+def ControlItemAddOp(builder, op):
+    builder.PrependUint8Slot(0, op, 0)
+
+def AddOp(builder, op):
+    ControlItemAddOp(builder, op)
+
+def ControlItemAddSymbol(builder, symbol):
+    builder.PrependUOffsetTRelativeSlot(1, flatbuffers.number_types.UOffsetTFlags.py_type(symbol), 0)
+
+def AddSymbol(builder, symbol):
+    ControlItemAddSymbol(builder, symbol)
+
+def ControlItemAddStartTime(builder, startTime):
+    builder.PrependUint64Slot(2, startTime, 0)
+
+def AddStartTime(builder, startTime):
+    ControlItemAddStartTime(builder, startTime)
+
+def ControlItemAddEndTime(builder, endTime):
+    builder.PrependUint64Slot(3, endTime, 0)
+
+def AddEndTime(builder, endTime):
+    ControlItemAddEndTime(builder, endTime)
+
+def ControlItemEnd(builder):
+    return builder.EndObject()
+
+def End(builder):
+    return ControlItemEnd(builder)
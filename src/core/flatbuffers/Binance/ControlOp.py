@@ -0,0 +1,11 @@
+# automatically generated by the FlatBuffers compiler, do not modify
+
+# namespace: Binance
+
+class ControlOp(object):
+    StartStream = 0
+    CloseStream = 1
+    FireKlines = 2
+    SubscribeKlines = 3
+    StartTrades = 4
+    DepthSnapshot = 5
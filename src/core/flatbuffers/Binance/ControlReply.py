@@ -0,0 +1,91 @@
+# automatically generated by the FlatBuffers compiler, do not modify
+
+# namespace: Binance
+
+import flatbuffers
+from flatbuffers.compat import import_numpy
+np = import_numpy()
+
+class ControlReply(object):
+    __slots__ = ['_tab']
+
+    @classmethod
+    def GetRootAs(cls, buf, offset=0):
+        n = flatbuffers.encode.Get(flatbuffers.packer.uoffset, buf, offset)
+        x = ControlReply()
+        x.Init(buf, n + offset)
+        return x
+
+    @classmethod
+    def GetRootAsControlReply(cls, buf, offset=0):
+        """This method is deprecated. Please switch to GetRootAs."""
+        return cls.GetRootAs(buf, offset)
+    @classmethod
+    def ControlReplyBufferHasIdentifier(cls, buf, offset, size_prefixed=False):
+        return flatbuffers.util.BufferHasIdentifier(buf, offset, b"\x4E\x4B\x43\x54", size_prefixed=size_prefixed)
+
+    # ControlReply
+    def Init(self, buf, pos):
+        self._tab = flatbuffers.table.Table(buf, pos)
+
+    # ControlReply
+    def RequestId(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(4))
+        if o != 0:
+            return self._tab.Get(flatbuffers.number_types.Uint64Flags, o + self._tab.Pos)
+        return 0
+
+    # ControlReply
+    def Results(self, j):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(6))
+        if o != 0:
+            x = self._tab.Vector(o)
+            x += flatbuffers.number_types.UOffsetTFlags.py_type(j) * 4
+            x = self._tab.Indirect(x)
+            from Binance.ControlResult import ControlResult
+            obj = ControlResult()
+            obj.Init(self._tab.Bytes, x)
+            return obj
+        return None
+
+    # ControlReply
+    def ResultsLength(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(6))
+        if o != 0:
+            return self._tab.VectorLen(o)
+        return 0
+
+    # ControlReply
+    def ResultsIsNone(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(6))
+        return o == 0
+
+def ControlReplyStart(builder):
+    builder.StartObject(2)
+
+def Start(builder):
+    ControlReplyStart(builder)
+
+def ControlReplyAddRequestId(builder, requestId):
+    builder.PrependUint64Slot(0, requestId, 0)
+
+def AddRequestId(builder, requestId):
+    ControlReplyAddRequestId(builder, requestId)
+
+def ControlReplyAddResults(builder, results):
+    builder.PrependUOffsetTRelativeSlot(1, flatbuffers.number_types.UOffsetTFlags.py_type(results), 0)
+
+def AddResults(builder, results):
+    ControlReplyAddResults(builder, results)
+
+def ControlReplyStartResultsVector(builder, numElems):
+    return builder.StartVector(4, numElems, 4)
+
+def StartResultsVector(builder, numElems):
+    return ControlReplyStartResultsVector(builder, numElems)
+
+def ControlReplyEnd(builder):
+    return builder.EndObject()
+
+def End(builder):
+    return ControlReplyEnd(builder)
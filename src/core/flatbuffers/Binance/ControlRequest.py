@@ -0,0 +1,91 @@
+# automatically generated by the FlatBuffers compiler, do not modify
+
+# namespace: Binance
+
+import flatbuffers
+from flatbuffers.compat import import_numpy
+np = import_numpy()
+
+class ControlRequest(object):
+    __slots__ = ['_tab']
+
+    @classmethod
+    def GetRootAs(cls, buf, offset=0):
+        n = flatbuffers.encode.Get(flatbuffers.packer.uoffset, buf, offset)
+        x = ControlRequest()
+        x.Init(buf, n + offset)
+        return x
+
+    @classmethod
+    def GetRootAsControlRequest(cls, buf, offset=0):
+        """This method is deprecated. Please switch to GetRootAs."""
+        return cls.GetRootAs(buf, offset)
+    @classmethod
+    def ControlRequestBufferHasIdentifier(cls, buf, offset, size_prefixed=False):
+        return flatbuffers.util.BufferHasIdentifier(buf, offset, b"\x4E\x4B\x43\x54", size_prefixed=size_prefixed)
+
+    # ControlRequest
+    def Init(self, buf, pos):
+        self._tab = flatbuffers.table.Table(buf, pos)
+
+    # ControlRequest
+    def RequestId(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(4))
+        if o != 0:
+            return self._tab.Get(flatbuffers.number_types.Uint64Flags, o + self._tab.Pos)
+        return 0
+
+    # ControlRequest
+    def Items(self, j):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(6))
+        if o != 0:
+            x = self._tab.Vector(o)
+            x += flatbuffers.number_types.UOffsetTFlags.py_type(j) * 4
+            x = self._tab.Indirect(x)
+            from Binance.ControlItem import ControlItem
+            obj = ControlItem()
+            obj.Init(self._tab.Bytes, x)
+            return obj
+        return None
+
+    # ControlRequest
+    def ItemsLength(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(6))
+        if o != 0:
+            return self._tab.VectorLen(o)
+        return 0
+
+    # ControlRequest
+    def ItemsIsNone(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(6))
+        return o == 0
+
+def ControlRequestStart(builder):
+    builder.StartObject(2)
+
+def Start(builder):
+    ControlRequestStart(builder)
+
+def ControlRequestAddRequestId(builder, requestId):
+    builder.PrependUint64Slot(0, requestId, 0)
+
+def AddRequestId(builder, requestId):
+    ControlRequestAddRequestId(builder, requestId)
+
+def ControlRequestAddItems(builder, items):
+    builder.PrependUOffsetTRelativeSlot(1, flatbuffers.number_types.UOffsetTFlags.py_type(items), 0)
+
+def AddItems(builder, items):
+    ControlRequestAddItems(builder, items)
+
+def ControlRequestStartItemsVector(builder, numElems):
+    return builder.StartVector(4, numElems, 4)
+
+def StartItemsVector(builder, numElems):
+    return ControlRequestStartItemsVector(builder, numElems)
+
+def ControlRequestEnd(builder):
+    return builder.EndObject()
+
+def End(builder):
+    return ControlRequestEnd(builder)
@@ -0,0 +1,67 @@
+# automatically generated by the FlatBuffers compiler, do not modify
+
+# namespace: Binance
+
+import flatbuffers
+from flatbuffers.compat import import_numpy
+np = import_numpy()
+
+class ControlResult(object):
+    __slots__ = ['_tab']
+
+    @classmethod
+    def GetRootAs(cls, buf, offset=0):
+        n = flatbuffers.encode.Get(flatbuffers.packer.uoffset, buf, offset)
+        x = ControlResult()
+        x.Init(buf, n + offset)
+        return x
+
+    @classmethod
+    def GetRootAsControlResult(cls, buf, offset=0):
+        """This method is deprecated. Please switch to GetRootAs."""
+        return cls.GetRootAs(buf, offset)
+    @classmethod
+    def ControlResultBufferHasIdentifier(cls, buf, offset, size_prefixed=False):
+        return flatbuffers.util.BufferHasIdentifier(buf, offset, b"\x4E\x4B\x43\x54", size_prefixed=size_prefixed)
+
+    # ControlResult
+    def Init(self, buf, pos):
+        self._tab = flatbuffers.table.Table(buf, pos)
+
+    # ControlResult
+    def Status(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(4))
+        if o != 0:
+            return self._tab.Get(flatbuffers.number_types.Uint8Flags, o + self._tab.Pos)
+        return 0
+
+    # ControlResult
+    def Message(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(6))
+        if o != 0:
+            return self._tab.String(o + self._tab.Pos)
+        return None
+
+def ControlResultStart(builder):
+    builder.StartObject(2)
+
+def Start(builder):
+    ControlResultStart(builder)
+
+def ControlResultAddStatus(builder, status):
+    builder.PrependUint8Slot(0, status, 0)
+
+def AddStatus(builder, status):
+    ControlResultAddStatus(builder, status)
+
+def ControlResultAddMessage(builder, message):
+    builder.PrependUOffsetTRelativeSlot(1, flatbuffers.number_types.UOffsetTFlags.py_type(message), 0)
+
+def AddMessage(builder, message):
+    ControlResultAddMessage(builder, message)
+
+def ControlResultEnd(builder):
+    return builder.EndObject()
+
+def End(builder):
+    return ControlResultEnd(builder)
@@ -0,0 +1,7 @@
+# automatically generated by the FlatBuffers compiler, do not modify
+
+# namespace: Binance
+
+class ControlStatus(object):
+    Ok = 0
+    Error = 1
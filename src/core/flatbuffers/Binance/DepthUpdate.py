@@ -0,0 +1,174 @@
+# automatically generated by the FlatBuffers compiler, do not modify
+
+# namespace: Binance
+
+import flatbuffers
+from flatbuffers.compat import import_numpy
+np = import_numpy()
+
+class DepthUpdate(object):
+    __slots__ = ['_tab']
+
+    @classmethod
+    def GetRootAs(cls, buf, offset=0):
+        n = flatbuffers.encode.Get(flatbuffers.packer.uoffset, buf, offset)
+        x = DepthUpdate()
+        x.Init(buf, n + offset)
+        return x
+
+    @classmethod
+    def GetRootAsDepthUpdate(cls, buf, offset=0):
+        """This method is deprecated. Please switch to GetRootAs."""
+        return cls.GetRootAs(buf, offset)
+    # DepthUpdate
+    def Init(self, buf, pos):
+        self._tab = flatbuffers.table.Table(buf, pos)
+
+    # DepthUpdate
+    def Symbol(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(4))
+        if o != 0:
+            return self._tab.String(o + self._tab.Pos)
+        return None
+
+    # DepthUpdate
+    def IsSnapshot(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(6))
+        if o != 0:
+            return bool(self._tab.Get(flatbuffers.number_types.BoolFlags, o + self._tab.Pos))
+        return False
+
+    # DepthUpdate
+    def FirstUpdateId(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(8))
+        if o != 0:
+            return self._tab.Get(flatbuffers.number_types.Uint64Flags, o + self._tab.Pos)
+        return 0
+
+    # DepthUpdate
+    def FinalUpdateId(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(10))
+        if o != 0:
+            return self._tab.Get(flatbuffers.number_types.Uint64Flags, o + self._tab.Pos)
+        return 0
+
+    # DepthUpdate
+    def EventTime(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(12))
+        if o != 0:
+            return self._tab.Get(flatbuffers.number_types.Uint64Flags, o + self._tab.Pos)
+        return 0
+
+    # DepthUpdate
+    def Bids(self, j):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(14))
+        if o != 0:
+            x = self._tab.Vector(o)
+            x += flatbuffers.number_types.UOffsetTFlags.py_type(j) * 16
+            from Binance.PriceLevel import PriceLevel
+            obj = PriceLevel()
+            obj.Init(self._tab.Bytes, x)
+            return obj
+        return None
+
+    # DepthUpdate
+    def BidsLength(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(14))
+        if o != 0:
+            return self._tab.VectorLen(o)
+        return 0
+
+    # DepthUpdate
+    def BidsIsNone(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(14))
+        return o == 0
+
+    # DepthUpdate
+    def Asks(self, j):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(16))
+        if o != 0:
+            x = self._tab.Vector(o)
+            x += flatbuffers.number_types.UOffsetTFlags.py_type(j) * 16
+            from Binance.PriceLevel import PriceLevel
+            obj = PriceLevel()
+            obj.Init(self._tab.Bytes, x)
+            return obj
+        return None
+
+    # DepthUpdate
+    def AsksLength(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(16))
+        if o != 0:
+            return self._tab.VectorLen(o)
+        return 0
+
+    # DepthUpdate
+    def AsksIsNone(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(16))
+        return o == 0
+
+def DepthUpdateStart(builder):
+    builder.StartObject(7)
+
+def Start(builder):
+    DepthUpdateStart(builder)
+
+def DepthUpdateAddSymbol(builder, symbol):
+    builder.PrependUOffsetTRelativeSlot(0, flatbuffers.number_types.UOffsetTFlags.py_type(symbol), 0)
+
+def AddSymbol(builder, symbol):
+    DepthUpdateAddSymbol(builder, symbol)
+
+def DepthUpdateAddIsSnapshot(builder, isSnapshot):
+    builder.PrependBoolSlot(1, isSnapshot, 0)
+
+def AddIsSnapshot(builder, isSnapshot):
+    DepthUpdateAddIsSnapshot(builder, isSnapshot)
+
+def DepthUpdateAddFirstUpdateId(builder, firstUpdateId):
+    builder.PrependUint64Slot(2, firstUpdateId, 0)
+
+def AddFirstUpdateId(builder, firstUpdateId):
+    DepthUpdateAddFirstUpdateId(builder, firstUpdateId)
+
+def DepthUpdateAddFinalUpdateId(builder, finalUpdateId):
+    builder.PrependUint64Slot(3, finalUpdateId, 0)
+
+def AddFinalUpdateId(builder, finalUpdateId):
+    DepthUpdateAddFinalUpdateId(builder, finalUpdateId)
+
+def DepthUpdateAddEventTime(builder, eventTime):
+    builder.PrependUint64Slot(4, eventTime, 0)
+
+def AddEventTime(builder, eventTime):
+    DepthUpdateAddEventTime(builder, eventTime)
+
+def DepthUpdateAddBids(builder, bids):
+    builder.PrependUOffsetTRelativeSlot(5, flatbuffers.number_types.UOffsetTFlags.py_type(bids), 0)
+
+def AddBids(builder, bids):
+    DepthUpdateAddBids(builder, bids)
+
+def DepthUpdateStartBidsVector(builder, numElems):
+    return builder.StartVector(16, numElems, 8)
+
+def StartBidsVector(builder, numElems):
+    return DepthUpdateStartBidsVector(builder, numElems)
+
+def DepthUpdateAddAsks(builder, asks):
+    builder.PrependUOffsetTRelativeSlot(6, flatbuffers.number_types.UOffsetTFlags.py_type(asks), 0)
+
+def AddAsks(builder, asks):
+    DepthUpdateAddAsks(builder, asks)
+
+def DepthUpdateStartAsksVector(builder, numElems):
+    return builder.StartVector(16, numElems, 8)
+
+def StartAsksVector(builder, numElems):
+    return DepthUpdateStartAsksVector(builder, numElems)
+
+def DepthUpdateEnd(builder):
+    return builder.EndObject()
+
+def End(builder):
+    return DepthUpdateEnd(builder)
@@ -108,8 +108,15 @@ class Kline(object):
             return self._tab.String(o + self._tab.Pos)
         return None
 
+    # Kline
+    def IsClosed(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(28))
+        if o != 0:
+            return bool(self._tab.Get(flatbuffers.number_types.BoolFlags, o + self._tab.Pos))
+        return False
+
 def KlineStart(builder):
-    builder.StartObject(12)
+    builder.StartObject(13)
 
 def Start(builder):
     KlineStart(builder)
@@ -186,6 +193,12 @@ def KlineAddIgnore(builder, ignore):
 def AddIgnore(builder, ignore):
     KlineAddIgnore(builder, ignore)
 
+def KlineAddIsClosed(builder, isClosed):
+    builder.PrependBoolSlot(12, isClosed, 0)
+
+def AddIsClosed(builder, isClosed):
+    KlineAddIsClosed(builder, isClosed)
+
 def KlineEnd(builder):
     return builder.EndObject()
 
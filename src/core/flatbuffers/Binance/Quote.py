@@ -0,0 +1,45 @@
+# automatically generated by the FlatBuffers compiler, do not modify
+
+# namespace: Binance
+
+import flatbuffers
+from flatbuffers.compat import import_numpy
+np = import_numpy()
+
+class Quote(object):
+    __slots__ = ['_tab']
+
+    @classmethod
+    def SizeOf(cls):
+        return 56
+
+    # Quote
+    def Init(self, buf, pos):
+        self._tab = flatbuffers.table.Table(buf, pos)
+
+    # Quote
+    def SymbolId(self): return self._tab.Get(flatbuffers.number_types.Uint32Flags, self._tab.Pos + flatbuffers.number_types.UOffsetTFlags.py_type(0))
+    # Quote
+    def UpdateId(self): return self._tab.Get(flatbuffers.number_types.Uint64Flags, self._tab.Pos + flatbuffers.number_types.UOffsetTFlags.py_type(8))
+    # Quote
+    def ReceiveTimeNs(self): return self._tab.Get(flatbuffers.number_types.Uint64Flags, self._tab.Pos + flatbuffers.number_types.UOffsetTFlags.py_type(16))
+    # Quote
+    def BidPrice(self): return self._tab.Get(flatbuffers.number_types.Float64Flags, self._tab.Pos + flatbuffers.number_types.UOffsetTFlags.py_type(24))
+    # Quote
+    def BidQty(self): return self._tab.Get(flatbuffers.number_types.Float64Flags, self._tab.Pos + flatbuffers.number_types.UOffsetTFlags.py_type(32))
+    # Quote
+    def AskPrice(self): return self._tab.Get(flatbuffers.number_types.Float64Flags, self._tab.Pos + flatbuffers.number_types.UOffsetTFlags.py_type(40))
+    # Quote
+    def AskQty(self): return self._tab.Get(flatbuffers.number_types.Float64Flags, self._tab.Pos + flatbuffers.number_types.UOffsetTFlags.py_type(48))
+
+def CreateQuote(builder, symbolId, updateId, receiveTimeNs, bidPrice, bidQty, askPrice, askQty):
+    builder.Prep(8, 56)
+    builder.PrependFloat64(askQty)
+    builder.PrependFloat64(askPrice)
+    builder.PrependFloat64(bidQty)
+    builder.PrependFloat64(bidPrice)
+    builder.PrependUint64(receiveTimeNs)
+    builder.PrependUint64(updateId)
+    builder.Pad(4)
+    builder.PrependUint32(symbolId)
+    return builder.Offset()
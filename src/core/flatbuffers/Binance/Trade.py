@@ -0,0 +1,128 @@
+# automatically generated by the FlatBuffers compiler, do not modify
+
+# namespace: Binance
+
+import flatbuffers
+from flatbuffers.compat import import_numpy
+np = import_numpy()
+
+class Trade(object):
+    __slots__ = ['_tab']
+
+    @classmethod
+    def GetRootAs(cls, buf, offset=0):
+        n = flatbuffers.encode.Get(flatbuffers.packer.uoffset, buf, offset)
+        x = Trade()
+        x.Init(buf, n + offset)
+        return x
+
+    @classmethod
+    def GetRootAsTrade(cls, buf, offset=0):
+        """This method is deprecated. Please switch to GetRootAs."""
+        return cls.GetRootAs(buf, offset)
+    # Trade
+    def Init(self, buf, pos):
+        self._tab = flatbuffers.table.Table(buf, pos)
+
+    # Trade
+    def Symbol(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(4))
+        if o != 0:
+            return self._tab.String(o + self._tab.Pos)
+        return None
+
+    # Trade
+    def TradeId(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(6))
+        if o != 0:
+            return self._tab.Get(flatbuffers.number_types.Uint64Flags, o + self._tab.Pos)
+        return 0
+
+    # Trade
+    def Price(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(8))
+        if o != 0:
+            return self._tab.Get(flatbuffers.number_types.Float64Flags, o + self._tab.Pos)
+        return 0.0
+
+    # Trade
+    def Quantity(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(10))
+        if o != 0:
+            return self._tab.Get(flatbuffers.number_types.Float64Flags, o + self._tab.Pos)
+        return 0.0
+
+    # Trade
+    def TradeTime(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(12))
+        if o != 0:
+            return self._tab.Get(flatbuffers.number_types.Uint64Flags, o + self._tab.Pos)
+        return 0
+
+    # Trade
+    def EventTime(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(14))
+        if o != 0:
+            return self._tab.Get(flatbuffers.number_types.Uint64Flags, o + self._tab.Pos)
+        return 0
+
+    # Trade
+    def IsBuyerMaker(self):
+        o = flatbuffers.number_types.UOffsetTFlags.py_type(self._tab.Offset(16))
+        if o != 0:
+            return bool(self._tab.Get(flatbuffers.number_types.BoolFlags, o + self._tab.Pos))
+        return False
+
+def TradeStart(builder):
+    builder.StartObject(7)
+
+def Start(builder):
+    TradeStart(builder)
+
+def TradeAddSymbol(builder, symbol):
+    builder.PrependUOffsetTRelativeSlot(0, flatbuffers.number_types.UOffsetTFlags.py_type(symbol), 0)
+
+def AddSymbol(builder, symbol):
+    TradeAddSymbol(builder, symbol)
+
+def TradeAddTradeId(builder, tradeId):
+    builder.PrependUint64Slot(1, tradeId, 0)
+
+def AddTradeId(builder, tradeId):
+    TradeAddTradeId(builder, tradeId)
+
+def TradeAddPrice(builder, price):
+    builder.PrependFloat64Slot(2, price, 0.0)
+
+def AddPrice(builder, price):
+    TradeAddPrice(builder, price)
+
+def TradeAddQuantity(builder, quantity):
+    builder.PrependFloat64Slot(3, quantity, 0.0)
+
+def AddQuantity(builder, quantity):
+    TradeAddQuantity(builder, quantity)
+
+def TradeAddTradeTime(builder, tradeTime):
+    builder.PrependUint64Slot(4, tradeTime, 0)
+
+def AddTradeTime(builder, tradeTime):
+    TradeAddTradeTime(builder, tradeTime)
+
+def TradeAddEventTime(builder, eventTime):
+    builder.PrependUint64Slot(5, eventTime, 0)
+
+def AddEventTime(builder, eventTime):
+    TradeAddEventTime(builder, eventTime)
+
+def TradeAddIsBuyerMaker(builder, isBuyerMaker):
+    builder.PrependBoolSlot(6, isBuyerMaker, 0)
+
+def AddIsBuyerMaker(builder, isBuyerMaker):
+    TradeAddIsBuyerMaker(builder, isBuyerMaker)
+
+def TradeEnd(builder):
+    return builder.EndObject()
+
+def End(builder):
+    return TradeEnd(builder)
@@ -0,0 +1,188 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_BINANCEBOOKTICKERBATCH_BINANCE_H_
+#define FLATBUFFERS_GENERATED_BINANCEBOOKTICKERBATCH_BINANCE_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+// Ensure the included flatbuffers.h is the same version as when this file was
+// generated, otherwise it may not be compatible.
+static_assert(FLATBUFFERS_VERSION_MAJOR == 25 &&
+              FLATBUFFERS_VERSION_MINOR == 9 &&
+              FLATBUFFERS_VERSION_REVISION == 23,
+             "Non-compatible flatbuffers version included");
+
+namespace Binance {
+
+struct Quote;
+
+struct BookTickerBatch;
+struct BookTickerBatchBuilder;
+
+FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(8) Quote FLATBUFFERS_FINAL_CLASS {
+ private:
+  uint32_t symbol_id_;
+  int32_t padding0__;
+  uint64_t update_id_;
+  uint64_t receive_time_ns_;
+  double bid_price_;
+  double bid_qty_;
+  double ask_price_;
+  double ask_qty_;
+
+ public:
+  Quote()
+      : symbol_id_(0),
+        padding0__(0),
+        update_id_(0),
+        receive_time_ns_(0),
+        bid_price_(0),
+        bid_qty_(0),
+        ask_price_(0),
+        ask_qty_(0) {
+    (void)padding0__;
+  }
+  Quote(uint32_t _symbol_id, uint64_t _update_id, uint64_t _receive_time_ns, double _bid_price, double _bid_qty, double _ask_price, double _ask_qty)
+      : symbol_id_(::flatbuffers::EndianScalar(_symbol_id)),
+        padding0__(0),
+        update_id_(::flatbuffers::EndianScalar(_update_id)),
+        receive_time_ns_(::flatbuffers::EndianScalar(_receive_time_ns)),
+        bid_price_(::flatbuffers::EndianScalar(_bid_price)),
+        bid_qty_(::flatbuffers::EndianScalar(_bid_qty)),
+        ask_price_(::flatbuffers::EndianScalar(_ask_price)),
+        ask_qty_(::flatbuffers::EndianScalar(_ask_qty)) {
+    (void)padding0__;
+  }
+  uint32_t symbol_id() const {
+    return ::flatbuffers::EndianScalar(symbol_id_);
+  }
+  uint64_t update_id() const {
+    return ::flatbuffers::EndianScalar(update_id_);
+  }
+  uint64_t receive_time_ns() const {
+    return ::flatbuffers::EndianScalar(receive_time_ns_);
+  }
+  double bid_price() const {
+    return ::flatbuffers::EndianScalar(bid_price_);
+  }
+  double bid_qty() const {
+    return ::flatbuffers::EndianScalar(bid_qty_);
+  }
+  double ask_price() const {
+    return ::flatbuffers::EndianScalar(ask_price_);
+  }
+  double ask_qty() const {
+    return ::flatbuffers::EndianScalar(ask_qty_);
+  }
+};
+FLATBUFFERS_STRUCT_END(Quote, 56);
+
+struct BookTickerBatch FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef BookTickerBatchBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_QUOTES = 4,
+    VT_PUBLISH_TIME_NS = 6,
+    VT_REGISTRY_HASH = 8
+  };
+  const ::flatbuffers::Vector<const Binance::Quote *> *quotes() const {
+    return GetPointer<const ::flatbuffers::Vector<const Binance::Quote *> *>(VT_QUOTES);
+  }
+  uint64_t publish_time_ns() const {
+    return GetField<uint64_t>(VT_PUBLISH_TIME_NS, 0);
+  }
+  uint64_t registry_hash() const {
+    return GetField<uint64_t>(VT_REGISTRY_HASH, 0);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_QUOTES) &&
+           verifier.VerifyVector(quotes()) &&
+           VerifyField<uint64_t>(verifier, VT_PUBLISH_TIME_NS, 8) &&
+           VerifyField<uint64_t>(verifier, VT_REGISTRY_HASH, 8) &&
+           verifier.EndTable();
+  }
+};
+
+struct BookTickerBatchBuilder {
+  typedef BookTickerBatch Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_quotes(::flatbuffers::Offset<::flatbuffers::Vector<const Binance::Quote *>> quotes) {
+    fbb_.AddOffset(BookTickerBatch::VT_QUOTES, quotes);
+  }
+  void add_publish_time_ns(uint64_t publish_time_ns) {
+    fbb_.AddElement<uint64_t>(BookTickerBatch::VT_PUBLISH_TIME_NS, publish_time_ns, 0);
+  }
+  void add_registry_hash(uint64_t registry_hash) {
+    fbb_.AddElement<uint64_t>(BookTickerBatch::VT_REGISTRY_HASH, registry_hash, 0);
+  }
+  explicit BookTickerBatchBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<BookTickerBatch> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<BookTickerBatch>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<BookTickerBatch> CreateBookTickerBatch(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::Vector<const Binance::Quote *>> quotes = 0,
+    uint64_t publish_time_ns = 0,
+    uint64_t registry_hash = 0) {
+  BookTickerBatchBuilder builder_(_fbb);
+  builder_.add_registry_hash(registry_hash);
+  builder_.add_publish_time_ns(publish_time_ns);
+  builder_.add_quotes(quotes);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<BookTickerBatch> CreateBookTickerBatchDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<Binance::Quote> *quotes = nullptr,
+    uint64_t publish_time_ns = 0,
+    uint64_t registry_hash = 0) {
+  auto quotes__ = quotes ? _fbb.CreateVectorOfStructs<Binance::Quote>(*quotes) : 0;
+  return Binance::CreateBookTickerBatch(
+      _fbb,
+      quotes__,
+      publish_time_ns,
+      registry_hash);
+}
+
+inline const Binance::BookTickerBatch *GetBookTickerBatch(const void *buf) {
+  return ::flatbuffers::GetRoot<Binance::BookTickerBatch>(buf);
+}
+
+inline const Binance::BookTickerBatch *GetSizePrefixedBookTickerBatch(const void *buf) {
+  return ::flatbuffers::GetSizePrefixedRoot<Binance::BookTickerBatch>(buf);
+}
+
+inline bool VerifyBookTickerBatchBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<Binance::BookTickerBatch>(nullptr);
+}
+
+inline bool VerifySizePrefixedBookTickerBatchBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<Binance::BookTickerBatch>(nullptr);
+}
+
+inline void FinishBookTickerBatchBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<Binance::BookTickerBatch> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedBookTickerBatchBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<Binance::BookTickerBatch> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+}  // namespace Binance
+
+#endif  // FLATBUFFERS_GENERATED_BINANCEBOOKTICKERBATCH_BINANCE_H_
@@ -0,0 +1,426 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_BINANCECONTROL_BINANCE_H_
+#define FLATBUFFERS_GENERATED_BINANCECONTROL_BINANCE_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+// Ensure the included flatbuffers.h is the same version as when this file was
+// generated, otherwise it may not be compatible.
+static_assert(FLATBUFFERS_VERSION_MAJOR == 25 &&
+              FLATBUFFERS_VERSION_MINOR == 9 &&
+              FLATBUFFERS_VERSION_REVISION == 23,
+             "Non-compatible flatbuffers version included");
+
+namespace Binance {
+
+struct ControlItem;
+struct ControlItemBuilder;
+
+struct ControlRequest;
+struct ControlRequestBuilder;
+
+struct ControlResult;
+struct ControlResultBuilder;
+
+struct ControlReply;
+struct ControlReplyBuilder;
+
+enum ControlOp : uint8_t {
+  ControlOp_StartStream = 0,
+  ControlOp_CloseStream = 1,
+  ControlOp_FireKlines = 2,
+  ControlOp_SubscribeKlines = 3,
+  ControlOp_StartTrades = 4,
+  ControlOp_DepthSnapshot = 5,
+  ControlOp_MIN = ControlOp_StartStream,
+  ControlOp_MAX = ControlOp_DepthSnapshot
+};
+
+inline const ControlOp (&EnumValuesControlOp())[6] {
+  static const ControlOp values[] = {
+    ControlOp_StartStream,
+    ControlOp_CloseStream,
+    ControlOp_FireKlines,
+    ControlOp_SubscribeKlines,
+    ControlOp_StartTrades,
+    ControlOp_DepthSnapshot
+  };
+  return values;
+}
+
+inline const char * const *EnumNamesControlOp() {
+  static const char * const names[7] = {
+    "StartStream",
+    "CloseStream",
+    "FireKlines",
+    "SubscribeKlines",
+    "StartTrades",
+    "DepthSnapshot",
+    nullptr
+  };
+  return names;
+}
+
+inline const char *EnumNameControlOp(ControlOp e) {
+  if (::flatbuffers::IsOutRange(e, ControlOp_StartStream, ControlOp_DepthSnapshot)) return "";
+  const size_t index = static_cast<size_t>(e);
+  return EnumNamesControlOp()[index];
+}
+
+enum ControlStatus : uint8_t {
+  ControlStatus_Ok = 0,
+  ControlStatus_Error = 1,
+  ControlStatus_MIN = ControlStatus_Ok,
+  ControlStatus_MAX = ControlStatus_Error
+};
+
+inline const ControlStatus (&EnumValuesControlStatus())[2] {
+  static const ControlStatus values[] = {
+    ControlStatus_Ok,
+    ControlStatus_Error
+  };
+  return values;
+}
+
+inline const char * const *EnumNamesControlStatus() {
+  static const char * const names[3] = {
+    "Ok",
+    "Error",
+    nullptr
+  };
+  return names;
+}
+
+inline const char *EnumNameControlStatus(ControlStatus e) {
+  if (::flatbuffers::IsOutRange(e, ControlStatus_Ok, ControlStatus_Error)) return "";
+  const size_t index = static_cast<size_t>(e);
+  return EnumNamesControlStatus()[index];
+}
+
+struct ControlItem FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef ControlItemBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_OP = 4,
+    VT_SYMBOL = 6,
+    VT_START_TIME = 8,
+    VT_END_TIME = 10
+  };
+  Binance::ControlOp op() const {
+    return static_cast<Binance::ControlOp>(GetField<uint8_t>(VT_OP, 0));
+  }
+  const ::flatbuffers::String *symbol() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_SYMBOL);
+  }
+  uint64_t start_time() const {
+    return GetField<uint64_t>(VT_START_TIME, 0);
+  }
+  uint64_t end_time() const {
+    return GetField<uint64_t>(VT_END_TIME, 0);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint8_t>(verifier, VT_OP, 1) &&
+           VerifyOffset(verifier, VT_SYMBOL) &&
+           verifier.VerifyString(symbol()) &&
+           VerifyField<uint64_t>(verifier, VT_START_TIME, 8) &&
+           VerifyField<uint64_t>(verifier, VT_END_TIME, 8) &&
+           verifier.EndTable();
+  }
+};
+
+struct ControlItemBuilder {
+  typedef ControlItem Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_op(Binance::ControlOp op) {
+    fbb_.AddElement<uint8_t>(ControlItem::VT_OP, static_cast<uint8_t>(op), 0);
+  }
+  void add_symbol(::flatbuffers::Offset<::flatbuffers::String> symbol) {
+    fbb_.AddOffset(ControlItem::VT_SYMBOL, symbol);
+  }
+  void add_start_time(uint64_t start_time) {
+    fbb_.AddElement<uint64_t>(ControlItem::VT_START_TIME, start_time, 0);
+  }
+  void add_end_time(uint64_t end_time) {
+    fbb_.AddElement<uint64_t>(ControlItem::VT_END_TIME, end_time, 0);
+  }
+  explicit ControlItemBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<ControlItem> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<ControlItem>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<ControlItem> CreateControlItem(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    Binance::ControlOp op = Binance::ControlOp_StartStream,
+    ::flatbuffers::Offset<::flatbuffers::String> symbol = 0,
+    uint64_t start_time = 0,
+    uint64_t end_time = 0) {
+  ControlItemBuilder builder_(_fbb);
+  builder_.add_end_time(end_time);
+  builder_.add_start_time(start_time);
+  builder_.add_symbol(symbol);
+  builder_.add_op(op);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<ControlItem> CreateControlItemDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    Binance::ControlOp op = Binance::ControlOp_StartStream,
+    const char *symbol = nullptr,
+    uint64_t start_time = 0,
+    uint64_t end_time = 0) {
+  auto symbol__ = symbol ? _fbb.CreateString(symbol) : 0;
+  return Binance::CreateControlItem(
+      _fbb,
+      op,
+      symbol__,
+      start_time,
+      end_time);
+}
+
+struct ControlRequest FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef ControlRequestBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_REQUEST_ID = 4,
+    VT_ITEMS = 6
+  };
+  uint64_t request_id() const {
+    return GetField<uint64_t>(VT_REQUEST_ID, 0);
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<Binance::ControlItem>> *items() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<Binance::ControlItem>> *>(VT_ITEMS);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint64_t>(verifier, VT_REQUEST_ID, 8) &&
+           VerifyOffset(verifier, VT_ITEMS) &&
+           verifier.VerifyVector(items()) &&
+           verifier.VerifyVectorOfTables(items()) &&
+           verifier.EndTable();
+  }
+};
+
+struct ControlRequestBuilder {
+  typedef ControlRequest Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_request_id(uint64_t request_id) {
+    fbb_.AddElement<uint64_t>(ControlRequest::VT_REQUEST_ID, request_id, 0);
+  }
+  void add_items(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<Binance::ControlItem>>> items) {
+    fbb_.AddOffset(ControlRequest::VT_ITEMS, items);
+  }
+  explicit ControlRequestBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<ControlRequest> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<ControlRequest>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<ControlRequest> CreateControlRequest(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    uint64_t request_id = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<Binance::ControlItem>>> items = 0) {
+  ControlRequestBuilder builder_(_fbb);
+  builder_.add_request_id(request_id);
+  builder_.add_items(items);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<ControlRequest> CreateControlRequestDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    uint64_t request_id = 0,
+    const std::vector<::flatbuffers::Offset<Binance::ControlItem>> *items = nullptr) {
+  auto items__ = items ? _fbb.CreateVector<::flatbuffers::Offset<Binance::ControlItem>>(*items) : 0;
+  return Binance::CreateControlRequest(
+      _fbb,
+      request_id,
+      items__);
+}
+
+struct ControlResult FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef ControlResultBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_STATUS = 4,
+    VT_MESSAGE = 6
+  };
+  Binance::ControlStatus status() const {
+    return static_cast<Binance::ControlStatus>(GetField<uint8_t>(VT_STATUS, 0));
+  }
+  const ::flatbuffers::String *message() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_MESSAGE);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint8_t>(verifier, VT_STATUS, 1) &&
+           VerifyOffset(verifier, VT_MESSAGE) &&
+           verifier.VerifyString(message()) &&
+           verifier.EndTable();
+  }
+};
+
+struct ControlResultBuilder {
+  typedef ControlResult Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_status(Binance::ControlStatus status) {
+    fbb_.AddElement<uint8_t>(ControlResult::VT_STATUS, static_cast<uint8_t>(status), 0);
+  }
+  void add_message(::flatbuffers::Offset<::flatbuffers::String> message) {
+    fbb_.AddOffset(ControlResult::VT_MESSAGE, message);
+  }
+  explicit ControlResultBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<ControlResult> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<ControlResult>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<ControlResult> CreateControlResult(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    Binance::ControlStatus status = Binance::ControlStatus_Ok,
+    ::flatbuffers::Offset<::flatbuffers::String> message = 0) {
+  ControlResultBuilder builder_(_fbb);
+  builder_.add_message(message);
+  builder_.add_status(status);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<ControlResult> CreateControlResultDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    Binance::ControlStatus status = Binance::ControlStatus_Ok,
+    const char *message = nullptr) {
+  auto message__ = message ? _fbb.CreateString(message) : 0;
+  return Binance::CreateControlResult(
+      _fbb,
+      status,
+      message__);
+}
+
+struct ControlReply FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef ControlReplyBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_REQUEST_ID = 4,
+    VT_RESULTS = 6
+  };
+  uint64_t request_id() const {
+    return GetField<uint64_t>(VT_REQUEST_ID, 0);
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<Binance::ControlResult>> *results() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<Binance::ControlResult>> *>(VT_RESULTS);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint64_t>(verifier, VT_REQUEST_ID, 8) &&
+           VerifyOffset(verifier, VT_RESULTS) &&
+           verifier.VerifyVector(results()) &&
+           verifier.VerifyVectorOfTables(results()) &&
+           verifier.EndTable();
+  }
+};
+
+struct ControlReplyBuilder {
+  typedef ControlReply Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_request_id(uint64_t request_id) {
+    fbb_.AddElement<uint64_t>(ControlReply::VT_REQUEST_ID, request_id, 0);
+  }
+  void add_results(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<Binance::ControlResult>>> results) {
+    fbb_.AddOffset(ControlReply::VT_RESULTS, results);
+  }
+  explicit ControlReplyBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<ControlReply> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<ControlReply>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<ControlReply> CreateControlReply(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    uint64_t request_id = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<Binance::ControlResult>>> results = 0) {
+  ControlReplyBuilder builder_(_fbb);
+  builder_.add_request_id(request_id);
+  builder_.add_results(results);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<ControlReply> CreateControlReplyDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    uint64_t request_id = 0,
+    const std::vector<::flatbuffers::Offset<Binance::ControlResult>> *results = nullptr) {
+  auto results__ = results ? _fbb.CreateVector<::flatbuffers::Offset<Binance::ControlResult>>(*results) : 0;
+  return Binance::CreateControlReply(
+      _fbb,
+      request_id,
+      results__);
+}
+
+inline const Binance::ControlRequest *GetControlRequest(const void *buf) {
+  return ::flatbuffers::GetRoot<Binance::ControlRequest>(buf);
+}
+
+inline const Binance::ControlRequest *GetSizePrefixedControlRequest(const void *buf) {
+  return ::flatbuffers::GetSizePrefixedRoot<Binance::ControlRequest>(buf);
+}
+
+inline const char *ControlRequestIdentifier() {
+  return "NKCT";
+}
+
+inline bool ControlRequestBufferHasIdentifier(const void *buf) {
+  return ::flatbuffers::BufferHasIdentifier(
+      buf, ControlRequestIdentifier());
+}
+
+inline bool SizePrefixedControlRequestBufferHasIdentifier(const void *buf) {
+  return ::flatbuffers::BufferHasIdentifier(
+      buf, ControlRequestIdentifier(), true);
+}
+
+inline bool VerifyControlRequestBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<Binance::ControlRequest>(ControlRequestIdentifier());
+}
+
+inline bool VerifySizePrefixedControlRequestBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<Binance::ControlRequest>(ControlRequestIdentifier());
+}
+
+inline void FinishControlRequestBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<Binance::ControlRequest> root) {
+  fbb.Finish(root, ControlRequestIdentifier());
+}
+
+inline void FinishSizePrefixedControlRequestBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<Binance::ControlRequest> root) {
+  fbb.FinishSizePrefixed(root, ControlRequestIdentifier());
+}
+
+}  // namespace Binance
+
+#endif  // FLATBUFFERS_GENERATED_BINANCECONTROL_BINANCE_H_
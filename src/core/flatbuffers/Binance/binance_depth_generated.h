@@ -0,0 +1,205 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_BINANCEDEPTH_BINANCE_H_
+#define FLATBUFFERS_GENERATED_BINANCEDEPTH_BINANCE_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+// Ensure the included flatbuffers.h is the same version as when this file was
+// generated, otherwise it may not be compatible.
+static_assert(FLATBUFFERS_VERSION_MAJOR == 25 &&
+              FLATBUFFERS_VERSION_MINOR == 9 &&
+              FLATBUFFERS_VERSION_REVISION == 23,
+             "Non-compatible flatbuffers version included");
+
+namespace Binance {
+
+struct PriceLevel;
+
+struct DepthUpdate;
+struct DepthUpdateBuilder;
+
+FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(8) PriceLevel FLATBUFFERS_FINAL_CLASS {
+ private:
+  double price_;
+  double quantity_;
+
+ public:
+  PriceLevel()
+      : price_(0),
+        quantity_(0) {
+  }
+  PriceLevel(double _price, double _quantity)
+      : price_(::flatbuffers::EndianScalar(_price)),
+        quantity_(::flatbuffers::EndianScalar(_quantity)) {
+  }
+  double price() const {
+    return ::flatbuffers::EndianScalar(price_);
+  }
+  double quantity() const {
+    return ::flatbuffers::EndianScalar(quantity_);
+  }
+};
+FLATBUFFERS_STRUCT_END(PriceLevel, 16);
+
+struct DepthUpdate FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef DepthUpdateBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_SYMBOL = 4,
+    VT_IS_SNAPSHOT = 6,
+    VT_FIRST_UPDATE_ID = 8,
+    VT_FINAL_UPDATE_ID = 10,
+    VT_EVENT_TIME = 12,
+    VT_BIDS = 14,
+    VT_ASKS = 16
+  };
+  const ::flatbuffers::String *symbol() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_SYMBOL);
+  }
+  bool is_snapshot() const {
+    return GetField<uint8_t>(VT_IS_SNAPSHOT, 0) != 0;
+  }
+  uint64_t first_update_id() const {
+    return GetField<uint64_t>(VT_FIRST_UPDATE_ID, 0);
+  }
+  uint64_t final_update_id() const {
+    return GetField<uint64_t>(VT_FINAL_UPDATE_ID, 0);
+  }
+  uint64_t event_time() const {
+    return GetField<uint64_t>(VT_EVENT_TIME, 0);
+  }
+  const ::flatbuffers::Vector<const Binance::PriceLevel *> *bids() const {
+    return GetPointer<const ::flatbuffers::Vector<const Binance::PriceLevel *> *>(VT_BIDS);
+  }
+  const ::flatbuffers::Vector<const Binance::PriceLevel *> *asks() const {
+    return GetPointer<const ::flatbuffers::Vector<const Binance::PriceLevel *> *>(VT_ASKS);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_SYMBOL) &&
+           verifier.VerifyString(symbol()) &&
+           VerifyField<uint8_t>(verifier, VT_IS_SNAPSHOT, 1) &&
+           VerifyField<uint64_t>(verifier, VT_FIRST_UPDATE_ID, 8) &&
+           VerifyField<uint64_t>(verifier, VT_FINAL_UPDATE_ID, 8) &&
+           VerifyField<uint64_t>(verifier, VT_EVENT_TIME, 8) &&
+           VerifyOffset(verifier, VT_BIDS) &&
+           verifier.VerifyVector(bids()) &&
+           VerifyOffset(verifier, VT_ASKS) &&
+           verifier.VerifyVector(asks()) &&
+           verifier.EndTable();
+  }
+};
+
+struct DepthUpdateBuilder {
+  typedef DepthUpdate Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_symbol(::flatbuffers::Offset<::flatbuffers::String> symbol) {
+    fbb_.AddOffset(DepthUpdate::VT_SYMBOL, symbol);
+  }
+  void add_is_snapshot(bool is_snapshot) {
+    fbb_.AddElement<uint8_t>(DepthUpdate::VT_IS_SNAPSHOT, static_cast<uint8_t>(is_snapshot), 0);
+  }
+  void add_first_update_id(uint64_t first_update_id) {
+    fbb_.AddElement<uint64_t>(DepthUpdate::VT_FIRST_UPDATE_ID, first_update_id, 0);
+  }
+  void add_final_update_id(uint64_t final_update_id) {
+    fbb_.AddElement<uint64_t>(DepthUpdate::VT_FINAL_UPDATE_ID, final_update_id, 0);
+  }
+  void add_event_time(uint64_t event_time) {
+    fbb_.AddElement<uint64_t>(DepthUpdate::VT_EVENT_TIME, event_time, 0);
+  }
+  void add_bids(::flatbuffers::Offset<::flatbuffers::Vector<const Binance::PriceLevel *>> bids) {
+    fbb_.AddOffset(DepthUpdate::VT_BIDS, bids);
+  }
+  void add_asks(::flatbuffers::Offset<::flatbuffers::Vector<const Binance::PriceLevel *>> asks) {
+    fbb_.AddOffset(DepthUpdate::VT_ASKS, asks);
+  }
+  explicit DepthUpdateBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<DepthUpdate> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<DepthUpdate>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<DepthUpdate> CreateDepthUpdate(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::String> symbol = 0,
+    bool is_snapshot = false,
+    uint64_t first_update_id = 0,
+    uint64_t final_update_id = 0,
+    uint64_t event_time = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<const Binance::PriceLevel *>> bids = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<const Binance::PriceLevel *>> asks = 0) {
+  DepthUpdateBuilder builder_(_fbb);
+  builder_.add_event_time(event_time);
+  builder_.add_final_update_id(final_update_id);
+  builder_.add_first_update_id(first_update_id);
+  builder_.add_asks(asks);
+  builder_.add_bids(bids);
+  builder_.add_symbol(symbol);
+  builder_.add_is_snapshot(is_snapshot);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<DepthUpdate> CreateDepthUpdateDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const char *symbol = nullptr,
+    bool is_snapshot = false,
+    uint64_t first_update_id = 0,
+    uint64_t final_update_id = 0,
+    uint64_t event_time = 0,
+    const std::vector<Binance::PriceLevel> *bids = nullptr,
+    const std::vector<Binance::PriceLevel> *asks = nullptr) {
+  auto symbol__ = symbol ? _fbb.CreateString(symbol) : 0;
+  auto bids__ = bids ? _fbb.CreateVectorOfStructs<Binance::PriceLevel>(*bids) : 0;
+  auto asks__ = asks ? _fbb.CreateVectorOfStructs<Binance::PriceLevel>(*asks) : 0;
+  return Binance::CreateDepthUpdate(
+      _fbb,
+      symbol__,
+      is_snapshot,
+      first_update_id,
+      final_update_id,
+      event_time,
+      bids__,
+      asks__);
+}
+
+inline const Binance::DepthUpdate *GetDepthUpdate(const void *buf) {
+  return ::flatbuffers::GetRoot<Binance::DepthUpdate>(buf);
+}
+
+inline const Binance::DepthUpdate *GetSizePrefixedDepthUpdate(const void *buf) {
+  return ::flatbuffers::GetSizePrefixedRoot<Binance::DepthUpdate>(buf);
+}
+
+inline bool VerifyDepthUpdateBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<Binance::DepthUpdate>(nullptr);
+}
+
+inline bool VerifySizePrefixedDepthUpdateBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<Binance::DepthUpdate>(nullptr);
+}
+
+inline void FinishDepthUpdateBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<Binance::DepthUpdate> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedDepthUpdateBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<Binance::DepthUpdate> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+}  // namespace Binance
+
+#endif  // FLATBUFFERS_GENERATED_BINANCEDEPTH_BINANCE_H_
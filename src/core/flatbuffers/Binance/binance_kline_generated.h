@@ -35,7 +35,8 @@ struct Kline FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
     VT_NUMBER_OF_TRADES = 20,
     VT_TAKER_BUY_BASE = 22,
     VT_TAKER_BUY_QUOTE = 24,
-    VT_IGNORE = 26
+    VT_IGNORE = 26,
+    VT_IS_CLOSED = 28
   };
   uint64_t open_time() const {
     return GetField<uint64_t>(VT_OPEN_TIME, 0);
@@ -73,6 +74,9 @@ struct Kline FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   const ::flatbuffers::String *ignore() const {
     return GetPointer<const ::flatbuffers::String *>(VT_IGNORE);
   }
+  bool is_closed() const {
+    return GetField<uint8_t>(VT_IS_CLOSED, 0) != 0;
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<uint64_t>(verifier, VT_OPEN_TIME, 8) &&
@@ -96,6 +100,7 @@ struct Kline FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
            verifier.VerifyString(taker_buy_quote()) &&
            VerifyOffset(verifier, VT_IGNORE) &&
            verifier.VerifyString(ignore()) &&
+           VerifyField<uint8_t>(verifier, VT_IS_CLOSED, 1) &&
            verifier.EndTable();
   }
 };
@@ -140,6 +145,9 @@ struct KlineBuilder {
   void add_ignore(::flatbuffers::Offset<::flatbuffers::String> ignore) {
     fbb_.AddOffset(Kline::VT_IGNORE, ignore);
   }
+  void add_is_closed(bool is_closed) {
+    fbb_.AddElement<uint8_t>(Kline::VT_IS_CLOSED, static_cast<uint8_t>(is_closed), 0);
+  }
   explicit KlineBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -164,7 +172,8 @@ inline ::flatbuffers::Offset<Kline> CreateKline(
     uint64_t number_of_trades = 0,
     ::flatbuffers::Offset<::flatbuffers::String> taker_buy_base = 0,
     ::flatbuffers::Offset<::flatbuffers::String> taker_buy_quote = 0,
-    ::flatbuffers::Offset<::flatbuffers::String> ignore = 0) {
+    ::flatbuffers::Offset<::flatbuffers::String> ignore = 0,
+    bool is_closed = false) {
   KlineBuilder builder_(_fbb);
   builder_.add_number_of_trades(number_of_trades);
   builder_.add_close_time(close_time);
@@ -178,6 +187,7 @@ inline ::flatbuffers::Offset<Kline> CreateKline(
   builder_.add_low_price(low_price);
   builder_.add_high_price(high_price);
   builder_.add_open_price(open_price);
+  builder_.add_is_closed(is_closed);
   return builder_.Finish();
 }
 
@@ -194,7 +204,8 @@ inline ::flatbuffers::Offset<Kline> CreateKlineDirect(
     uint64_t number_of_trades = 0,
     const char *taker_buy_base = nullptr,
     const char *taker_buy_quote = nullptr,
-    const char *ignore = nullptr) {
+    const char *ignore = nullptr,
+    bool is_closed = false) {
   auto open_price__ = open_price ? _fbb.CreateString(open_price) : 0;
   auto high_price__ = high_price ? _fbb.CreateString(high_price) : 0;
   auto low_price__ = low_price ? _fbb.CreateString(low_price) : 0;
@@ -217,7 +228,8 @@ inline ::flatbuffers::Offset<Kline> CreateKlineDirect(
       number_of_trades,
       taker_buy_base__,
       taker_buy_quote__,
-      ignore__);
+      ignore__,
+      is_closed);
 }
 
 struct Klines FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
@@ -0,0 +1,176 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_BINANCETRADE_BINANCE_H_
+#define FLATBUFFERS_GENERATED_BINANCETRADE_BINANCE_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+// Ensure the included flatbuffers.h is the same version as when this file was
+// generated, otherwise it may not be compatible.
+static_assert(FLATBUFFERS_VERSION_MAJOR == 25 &&
+              FLATBUFFERS_VERSION_MINOR == 9 &&
+              FLATBUFFERS_VERSION_REVISION == 23,
+             "Non-compatible flatbuffers version included");
+
+namespace Binance {
+
+struct Trade;
+struct TradeBuilder;
+
+struct Trade FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef TradeBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_SYMBOL = 4,
+    VT_TRADE_ID = 6,
+    VT_PRICE = 8,
+    VT_QUANTITY = 10,
+    VT_TRADE_TIME = 12,
+    VT_EVENT_TIME = 14,
+    VT_IS_BUYER_MAKER = 16
+  };
+  const ::flatbuffers::String *symbol() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_SYMBOL);
+  }
+  uint64_t trade_id() const {
+    return GetField<uint64_t>(VT_TRADE_ID, 0);
+  }
+  double price() const {
+    return GetField<double>(VT_PRICE, 0.0);
+  }
+  double quantity() const {
+    return GetField<double>(VT_QUANTITY, 0.0);
+  }
+  uint64_t trade_time() const {
+    return GetField<uint64_t>(VT_TRADE_TIME, 0);
+  }
+  uint64_t event_time() const {
+    return GetField<uint64_t>(VT_EVENT_TIME, 0);
+  }
+  bool is_buyer_maker() const {
+    return GetField<uint8_t>(VT_IS_BUYER_MAKER, 0) != 0;
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_SYMBOL) &&
+           verifier.VerifyString(symbol()) &&
+           VerifyField<uint64_t>(verifier, VT_TRADE_ID, 8) &&
+           VerifyField<double>(verifier, VT_PRICE, 8) &&
+           VerifyField<double>(verifier, VT_QUANTITY, 8) &&
+           VerifyField<uint64_t>(verifier, VT_TRADE_TIME, 8) &&
+           VerifyField<uint64_t>(verifier, VT_EVENT_TIME, 8) &&
+           VerifyField<uint8_t>(verifier, VT_IS_BUYER_MAKER, 1) &&
+           verifier.EndTable();
+  }
+};
+
+struct TradeBuilder {
+  typedef Trade Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_symbol(::flatbuffers::Offset<::flatbuffers::String> symbol) {
+    fbb_.AddOffset(Trade::VT_SYMBOL, symbol);
+  }
+  void add_trade_id(uint64_t trade_id) {
+    fbb_.AddElement<uint64_t>(Trade::VT_TRADE_ID, trade_id, 0);
+  }
+  void add_price(double price) {
+    fbb_.AddElement<double>(Trade::VT_PRICE, price, 0.0);
+  }
+  void add_quantity(double quantity) {
+    fbb_.AddElement<double>(Trade::VT_QUANTITY, quantity, 0.0);
+  }
+  void add_trade_time(uint64_t trade_time) {
+    fbb_.AddElement<uint64_t>(Trade::VT_TRADE_TIME, trade_time, 0);
+  }
+  void add_event_time(uint64_t event_time) {
+    fbb_.AddElement<uint64_t>(Trade::VT_EVENT_TIME, event_time, 0);
+  }
+  void add_is_buyer_maker(bool is_buyer_maker) {
+    fbb_.AddElement<uint8_t>(Trade::VT_IS_BUYER_MAKER, static_cast<uint8_t>(is_buyer_maker), 0);
+  }
+  explicit TradeBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<Trade> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<Trade>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<Trade> CreateTrade(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::String> symbol = 0,
+    uint64_t trade_id = 0,
+    double price = 0.0,
+    double quantity = 0.0,
+    uint64_t trade_time = 0,
+    uint64_t event_time = 0,
+    bool is_buyer_maker = false) {
+  TradeBuilder builder_(_fbb);
+  builder_.add_event_time(event_time);
+  builder_.add_trade_time(trade_time);
+  builder_.add_quantity(quantity);
+  builder_.add_price(price);
+  builder_.add_trade_id(trade_id);
+  builder_.add_symbol(symbol);
+  builder_.add_is_buyer_maker(is_buyer_maker);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<Trade> CreateTradeDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const char *symbol = nullptr,
+    uint64_t trade_id = 0,
+    double price = 0.0,
+    double quantity = 0.0,
+    uint64_t trade_time = 0,
+    uint64_t event_time = 0,
+    bool is_buyer_maker = false) {
+  auto symbol__ = symbol ? _fbb.CreateString(symbol) : 0;
+  return Binance::CreateTrade(
+      _fbb,
+      symbol__,
+      trade_id,
+      price,
+      quantity,
+      trade_time,
+      event_time,
+      is_buyer_maker);
+}
+
+inline const Binance::Trade *GetTrade(const void *buf) {
+  return ::flatbuffers::GetRoot<Binance::Trade>(buf);
+}
+
+inline const Binance::Trade *GetSizePrefixedTrade(const void *buf) {
+  return ::flatbuffers::GetSizePrefixedRoot<Binance::Trade>(buf);
+}
+
+inline bool VerifyTradeBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<Binance::Trade>(nullptr);
+}
+
+inline bool VerifySizePrefixedTradeBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<Binance::Trade>(nullptr);
+}
+
+inline void FinishTradeBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<Binance::Trade> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedTradeBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<Binance::Trade> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+}  // namespace Binance
+
+#endif  // FLATBUFFERS_GENERATED_BINANCETRADE_BINANCE_H_
@@ -0,0 +1,227 @@
+#include "kline_cache.hpp"
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <type_traits>
+#include <fmt/core.h>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr uint32_t kSegmentMagic = 0x434B4B4E; // "NKKC"
+constexpr uint32_t kSegmentVersion = 1;
+constexpr size_t kHeaderSize = 32;
+constexpr size_t kRecordSize = sizeof(KlineData);
+// Roll over to a new file after this many candles (45 days of 1m candles)
+constexpr size_t kMaxSegmentCandles = 65536;
+
+static_assert(std::is_trivially_copyable_v<KlineData> && sizeof(KlineData) == 56,
+              "Segment records are raw KlineData; bump kSegmentVersion if the layout changes");
+
+struct SegmentHeader {
+    uint32_t magic = kSegmentMagic;
+    uint32_t version = kSegmentVersion;
+    uint64_t intervalMs = 0;
+    uint64_t coverStart = 0;
+    uint64_t reserved = 0;
+};
+static_assert(sizeof(SegmentHeader) == kHeaderSize);
+
+uint64_t openTimeAt(std::ifstream& in, size_t index) {
+    uint64_t openTime = 0;
+    in.seekg(static_cast<std::streamoff>(kHeaderSize + index * kRecordSize));
+    in.read(reinterpret_cast<char*>(&openTime), sizeof(openTime));
+    return openTime;
+}
+
+// First record index in [0, count) with open_time >= openTime
+size_t lowerBound(std::ifstream& in, size_t count, uint64_t openTime) {
+    size_t lo = 0, hi = count;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (openTimeAt(in, mid) < openTime) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+} // namespace
+
+// ------------------ KlineSeriesCache ------------------
+KlineSeriesCache::KlineSeriesCache(fs::path dir, uint64_t intervalMs)
+    : dir_(std::move(dir)),
+      intervalMs_(intervalMs)
+{
+    std::error_code ec;
+    fs::create_directories(dir_, ec);
+    load();
+}
+
+void KlineSeriesCache::load() {
+    std::error_code ec;
+    for (const fs::directory_entry& entry : fs::directory_iterator(dir_, ec)) {
+        if (!entry.is_regular_file(ec) || entry.path().extension() != ".seg") continue;
+
+        uint64_t size = entry.file_size(ec);
+        if (ec || size < kHeaderSize + kRecordSize) continue;
+
+        std::ifstream in(entry.path(), std::ios::binary);
+        SegmentHeader header;
+        if (!in.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+            header.magic != kSegmentMagic || header.version != kSegmentVersion || header.intervalMs != intervalMs_) {
+            continue;
+        }
+
+        Segment segment;
+        segment.path = entry.path();
+        segment.coverStart = header.coverStart;
+        segment.count = static_cast<size_t>((size - kHeaderSize) / kRecordSize);
+        segment.lastOpen = openTimeAt(in, segment.count - 1);
+        if (!in) continue;
+        in.close();
+
+        // A crash mid-append leaves part of a record; drop it so the next append lines up
+        uint64_t intact = kHeaderSize + segment.count * kRecordSize;
+        if (size != intact) fs::resize_file(segment.path, intact, ec);
+
+        segments_.push_back(std::move(segment));
+    }
+    std::sort(segments_.begin(), segments_.end(),
+              [](const Segment& a, const Segment& b) { return a.coverStart < b.coverStart; });
+}
+
+size_t KlineSeriesCache::firstAfter(uint64_t openTime) const {
+    auto it = std::upper_bound(segments_.begin(), segments_.end(), openTime,
+                               [](uint64_t t, const Segment& s) { return t < s.coverStart; });
+    return static_cast<size_t>(it - segments_.begin());
+}
+
+size_t KlineSeriesCache::covering(uint64_t openTime) const {
+    size_t next = firstAfter(openTime);
+    if (next == 0) return npos;
+    const Segment& segment = segments_[next - 1];
+    return openTime <= segment.lastOpen ? next - 1 : npos;
+}
+
+std::vector<KlineData> KlineSeriesCache::read(TimeRange range) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<KlineData> candles;
+    for (const Segment& segment : segments_) {
+        if (segment.lastOpen < range.from) continue;
+        if (segment.coverStart > range.to) break;
+
+        std::ifstream in(segment.path, std::ios::binary);
+        size_t first = lowerBound(in, segment.count, range.from);
+        size_t last = lowerBound(in, segment.count, range.to == UINT64_MAX ? range.to : range.to + 1);
+        if (!in || first >= last) continue;
+
+        size_t offset = candles.size();
+        candles.resize(offset + (last - first));
+        in.seekg(static_cast<std::streamoff>(kHeaderSize + first * kRecordSize));
+        in.read(reinterpret_cast<char*>(candles.data() + offset), static_cast<std::streamsize>((last - first) * kRecordSize));
+        if (!in) candles.resize(offset);
+    }
+    return candles;
+}
+
+std::vector<TimeRange> KlineSeriesCache::missing(TimeRange range) const {
+    std::vector<TimeRange> gaps;
+    uint64_t from = range.from - range.from % intervalMs_;
+    uint64_t to = range.to - range.to % intervalMs_;
+    if (from > to) return gaps;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    uint64_t cursor = from;
+    for (const Segment& segment : segments_) {
+        if (segment.lastOpen < cursor) continue;
+        if (segment.coverStart > to) break;
+        if (segment.coverStart > cursor) gaps.push_back({cursor, segment.coverStart - intervalMs_});
+        cursor = segment.lastOpen + intervalMs_;
+        if (cursor > to) break;
+    }
+    if (cursor <= to) gaps.push_back({cursor, to});
+    return gaps;
+}
+
+uint64_t KlineSeriesCache::newestOpen() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return segments_.empty() ? 0 : segments_.back().lastOpen;
+}
+
+bool KlineSeriesCache::write(Segment& segment, const KlineData* candles, size_t count, bool create) {
+    std::ofstream out(segment.path, std::ios::binary | (create ? std::ios::trunc : std::ios::app));
+    if (create) {
+        SegmentHeader header;
+        header.intervalMs = intervalMs_;
+        header.coverStart = segment.coverStart;
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    }
+    out.write(reinterpret_cast<const char*>(candles), static_cast<std::streamsize>(count * kRecordSize));
+    out.flush();
+    if (!out) return false;
+
+    segment.count += count;
+    segment.lastOpen = candles[count - 1].open_time;
+    return true;
+}
+
+size_t KlineSeriesCache::append(const std::vector<KlineData>& batch, size_t closedCount) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t written = 0;
+    size_t i = 0;
+    closedCount = std::min(closedCount, batch.size());
+    while (i < closedCount) {
+        const KlineData& first = batch[i];
+        if (covering(first.open_time) != npos) { ++i; continue; }
+
+        // Longest run of new closed candles, one interval apart, that stops short of the
+        // next segment. A hole in the batch (a short REST page, live updates dropped by a
+        // full queue) ends the run, so missing() still reports it.
+        size_t next = firstAfter(first.open_time);
+        uint64_t limit = next < segments_.size() ? segments_[next].coverStart : UINT64_MAX;
+        size_t end = i + 1;
+        while (end < closedCount &&
+               batch[end].open_time == batch[end - 1].open_time + intervalMs_ && batch[end].open_time < limit) {
+            ++end;
+        }
+
+        // Extend the segment this run continues, or start a new one
+        size_t target = next > 0 ? next - 1 : npos;
+        bool extends = target != npos && first.open_time <= segments_[target].lastOpen + intervalMs_;
+        bool create = !extends || segments_[target].count >= kMaxSegmentCandles;
+        if (create) {
+            Segment segment;
+            // A full segment hands over to its successor without leaving a gap in coverage
+            segment.coverStart = extends ? segments_[target].lastOpen + intervalMs_ : first.open_time;
+            segment.path = dir_ / fmt::format("{:016}.seg", segment.coverStart);
+            segments_.insert(segments_.begin() + next, std::move(segment));
+            target = next;
+        }
+
+        if (!write(segments_[target], &batch[i], end - i, create)) {
+            if (segments_[target].count == 0) segments_.erase(segments_.begin() + target);
+            break;
+        }
+        written += end - i;
+        i = end;
+    }
+    return written;
+}
+
+// ------------------ KlineCache ------------------
+KlineCache::KlineCache(fs::path root)
+    : root_(std::move(root))
+{
+}
+
+KlineSeriesCache& KlineCache::series(const std::string& symbol, ChartTimeframe timeframe) {
+    std::string upper = symbol;
+    std::transform(upper.begin(), upper.end(), upper.begin(), [](unsigned char c) { return static_cast<char>(std::toupper(c)); });
+    std::string key = upper + "/" + kTimeframeNames[timeframe];
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::unique_ptr<KlineSeriesCache>& series = series_[key];
+    if (!series) series = std::make_unique<KlineSeriesCache>(root_ / upper / kTimeframeNames[timeframe], kTimeframeMs[timeframe]);
+    return *series;
+}
@@ -0,0 +1,90 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "core/binance_kline.hpp"
+#include "core/time_range.hpp"
+#include "core/timeframe_resampler.hpp"
+
+// Downloaded candles of one symbol and interval, kept on disk so a restart (or a switch
+// back to the symbol) starts from what is already there and only the gaps are fetched.
+//
+// The series is a directory of append-only segment files. Each segment covers one
+// unbroken stretch of time: a run of REST pages or pushed candles with nothing missing
+// between them. Only candles the exchange marked final are stored, so a written record
+// never changes.
+//
+// Segment file <coverStart>.seg (little endian):
+//   0   u32 magic 'NKKC'       4  u32 version
+//   8   u64 intervalMs        16  u64 coverStart (open_time the coverage starts at)
+//   24  u64 reserved
+//   32  KlineData records, 56 bytes each, ascending open_time
+// A segment covers [coverStart, newest record's open_time]. The index (one entry per
+// segment, ordered by coverStart) is rebuilt from the headers and last records when the
+// series is opened, so there is no index file to fall out of step with the data. A torn
+// record left by a crash is cut off at open.
+class KlineSeriesCache {
+public:
+    KlineSeriesCache(std::filesystem::path dir, uint64_t intervalMs);
+
+    KlineSeriesCache(const KlineSeriesCache&) = delete;
+    KlineSeriesCache& operator=(const KlineSeriesCache&) = delete;
+
+    // Cached candles with open_time in `range`, oldest first
+    std::vector<KlineData> read(TimeRange range) const;
+
+    // Parts of `range` no segment covers, oldest first, in interval-aligned open_times.
+    // Empty when the whole range is stored, which includes its last candle once the
+    // exchange's clock (which closes candles) is a little ahead of the local one.
+    std::vector<TimeRange> missing(TimeRange range) const;
+
+    // open_time of the newest stored candle, 0 when the series is empty
+    uint64_t newestOpen() const;
+
+    // Store the first `closedCount` candles of one contiguous batch, i.e. one REST page
+    // or one pushed update: the ones the exchange reported final. A record is never
+    // rewritten, so a forming candle must not get in. Candles already covered are
+    // skipped; a batch that starts right after a segment extends it. Returns the
+    // number written.
+    size_t append(const std::vector<KlineData>& batch, size_t closedCount);
+
+    uint64_t intervalMs() const { return intervalMs_; }
+
+private:
+    struct Segment {
+        std::filesystem::path path;
+        uint64_t coverStart = 0;
+        uint64_t lastOpen = 0; // open_time of the newest record
+        size_t count = 0;
+    };
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    void load();
+    size_t covering(uint64_t openTime) const;  // Segment covering openTime, or npos
+    size_t firstAfter(uint64_t openTime) const; // First segment starting after openTime
+    bool write(Segment& segment, const KlineData* candles, size_t count, bool create);
+
+    mutable std::mutex mutex_; // append() runs on the pipeline thread, reads on the UI thread
+    std::filesystem::path dir_;
+    uint64_t intervalMs_;
+    std::vector<Segment> segments_; // Ordered by coverStart, coverage never overlaps
+};
+
+// Cache root; each series lives in <root>/<SYMBOL>/<interval>/
+class KlineCache {
+public:
+    explicit KlineCache(std::filesystem::path root);
+
+    // Opened (and indexed) on first use; the reference stays valid as long as the cache
+    KlineSeriesCache& series(const std::string& symbol, ChartTimeframe timeframe);
+
+private:
+    std::mutex mutex_;
+    std::filesystem::path root_;
+    std::unordered_map<std::string, std::unique_ptr<KlineSeriesCache>> series_;
+};
@@ -0,0 +1,393 @@
+#include "market_data_pipeline.hpp"
+#include "core/BinanceBookTickerDecoder.hpp"
+#include "core/BinanceKlineDecoder.hpp"
+#include "core/BinanceDepthDecoder.hpp"
+#include "core/BinanceTradeDecoder.hpp"
+#include <algorithm>
+#include <fmt/core.h>
+
+namespace NikTrade {
+
+// Upper bound on snapshot publishes; the UI never renders faster than this anyway
+static constexpr auto kMinPublishInterval = std::chrono::milliseconds(4);
+// Longest idle wait; bounds how late a throttled publish or stop() is noticed
+static constexpr auto kIdleWait = std::chrono::milliseconds(50);
+// Diffs kept per book while it waits for a snapshot (~100 s of a 100 ms depth stream)
+static constexpr size_t kMaxBufferedDiffs = 1000;
+// A book still waiting after this many diffs has missed its snapshot; ask for another
+static constexpr size_t kResyncAfterDiffs = 100;
+// At most one snapshot request per symbol per interval (REST depth calls are weighted)
+static constexpr auto kResyncInterval = std::chrono::seconds(5);
+// 1m bars kept as the resampling base (one day, so 1h/1d have something to roll up)
+static constexpr size_t kBaseBars = 1440;
+
+// Timeframes resampled from the 1m base (must stay in ChartTimeframe order after kTf1m)
+static std::vector<uint64_t> resampledIntervals() {
+    return std::vector<uint64_t>(kTimeframeMs + kTf5m, kTimeframeMs + kTimeframeCount);
+}
+
+static uint64_t wallClockMs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+}
+
+MarketDataPipeline::MarketDataPipeline(Binance::ZMQTransport& transport,
+                                       Binance::ZMQSubscriber& bookTickerSub,
+                                       Binance::ZMQSubscriber& bookTickerBatchSub,
+                                       Binance::ZMQSubscriber& depthSub,
+                                       Binance::ZMQSubscriber& klineSub,
+                                       Binance::ZMQSubscriber& tradeSub,
+                                       Binance::ZMQSubscriber& latencySub,
+                                       FileLogger& logger,
+                                       size_t maxBars)
+    : transport_(transport),
+      bookTickerSub_(bookTickerSub),
+      bookTickerBatchSub_(bookTickerBatchSub),
+      depthSub_(depthSub),
+      klineSub_(klineSub),
+      tradeSub_(tradeSub),
+      latencySub_(latencySub),
+      logger_(logger),
+      resampler_(resampledIntervals(), maxBars),
+      snapshot_(std::make_shared<const MarketSnapshot>())
+{
+    pendingBookTickers_.resize(transport_.symbols().size());
+    pendingSymbols_.reserve(300);
+    depthBooks_.resize(transport_.symbols().size());
+    changedBooks_.reserve(300);
+    latestBBOs_.reserve(300);
+    decodedKlines_.reserve(1000);
+    decodedQuotes_.reserve(256);
+    lastQuoteNs_.resize(transport_.symbols().size());
+    aggregators_.emplace_back(kTimeframeMs[kTf1s], maxBars);
+    aggregators_.emplace_back(kTimeframeMs[kTf1m], kBaseBars);
+}
+
+MarketDataPipeline::~MarketDataPipeline() {
+    stop();
+}
+
+void MarketDataPipeline::attachNativeFeed(Binance::BinanceWsFeed& feed) {
+    nativeFeed_ = &feed;
+}
+
+void MarketDataPipeline::attachKlineCache(KlineSeriesCache& cache) {
+    klineCache_ = &cache;
+}
+
+void MarketDataPipeline::seedKlines(const std::vector<KlineData>& klines) {
+    for (size_t i = 0; i < aggregators_.size(); ++i) {
+        if (aggregators_[i].mergeBars(klines)) dirty_ = true;
+    }
+}
+
+void MarketDataPipeline::start() {
+    if (!running_.exchange(true)) {
+        workerThread_ = std::thread(&MarketDataPipeline::run, this);
+    }
+}
+
+void MarketDataPipeline::stop() noexcept {
+    running_.store(false, std::memory_order_release);
+    if (workerThread_.joinable()) workerThread_.join();
+}
+
+std::shared_ptr<const MarketSnapshot> MarketDataPipeline::snapshot() const {
+    std::lock_guard<std::mutex> lock(snapshotMutex_);
+    return snapshot_;
+}
+
+void MarketDataPipeline::takeDepthResyncs(std::vector<SymbolId>& out) {
+    std::lock_guard<std::mutex> lock(resyncMutex_);
+    out.insert(out.end(), resyncRequests_.begin(), resyncRequests_.end());
+    resyncRequests_.clear();
+}
+
+void MarketDataPipeline::run() {
+    while (running_.load(std::memory_order_acquire)) {
+        bool worked = false;
+        worked |= drainBookTickers();
+        worked |= drainBookTickerBatches();
+        worked |= drainDepth();
+        worked |= drainKlines();
+        worked |= drainTrades();
+        worked |= drainLatency();
+        if (nativeFeed_) worked |= drainNativeFeed();
+
+        advanceBars();
+
+        auto now = std::chrono::steady_clock::now();
+        if (dirty_ && now - lastPublish_ >= kMinPublishInterval) {
+            publish();
+            lastPublish_ = now;
+        }
+
+        if (worked) continue;
+        // Sleep until the transport queues something; wake early if a publish is still owed
+        transport_.waitForData(dirty_ ? kMinPublishInterval : kIdleWait);
+    }
+}
+
+// ------------------ BookTicker ------------------
+// Only the newest payload per symbol is kept; older ones are superseded before they are decoded.
+bool MarketDataPipeline::drainBookTickers() {
+    bool worked = false;
+    Binance::FeedMessage msg;
+    while (bookTickerSub_.pop(msg)) {
+        worked = true;
+        if (msg.symbolId >= pendingBookTickers_.size() || msg.payload.empty()) continue;
+
+        std::vector<uint8_t>& pending = pendingBookTickers_[msg.symbolId];
+        if (pending.empty()) pendingSymbols_.push_back(msg.symbolId);
+        pending = std::move(msg.payload);
+    }
+    if (worked) dirty_ = true;
+    return worked;
+}
+
+// Batched frames carry numeric quotes, so they are decoded right away; within and
+// across batches the last quote per symbol wins. The inter-arrival gap of the newest
+// quote replaces the per-update feed_latency message the single-update path uses.
+// A batch holds every active symbol, so only the quotes of symbols an open window
+// subscribed (the per-symbol bookticker route's topics) are kept.
+bool MarketDataPipeline::drainBookTickerBatches() {
+    bool worked = false;
+    Binance::FeedMessage msg;
+    while (bookTickerBatchSub_.pop(msg)) {
+        worked = true;
+        if (nativeFeed_) continue; // An attached native feed owns bookticker
+
+        decodedQuotes_.clear();
+        if (decodeBookTickerBatch(msg.payload, transport_.symbols(), decodedQuotes_) == 0) {
+            if (!warnedBadBatch_) {
+                logger_.logInfo("[WARN] Dropping bookticker batches: malformed or built from a different symbols file");
+                warnedBadBatch_ = true;
+            }
+            continue;
+        }
+
+        for (BatchedQuote& quote : decodedQuotes_) {
+            SymbolId symbolId = quote.bbo.symbol;
+            uint64_t& lastNs = lastQuoteNs_[symbolId];
+            if (lastNs && quote.receiveTimeNs > lastNs) {
+                working_.latencyMessage = fmt::format("{} ms", (quote.receiveTimeNs - lastNs) / 1'000'000);
+            }
+            lastNs = quote.receiveTimeNs;
+            if (!bookTickerSub_.hasTopic(symbolId)) continue;
+            latestBBOs_[symbolId] = std::move(quote.bbo);
+            bbosChanged_ = true;
+        }
+        dirty_ = true;
+    }
+    return worked;
+}
+
+// ------------------ Depth ------------------
+// Every diff is applied in order (unlike bookticker nothing can be skipped); only the
+// render copy of the top levels is deferred to publish().
+bool MarketDataPipeline::drainDepth() {
+    bool worked = false;
+    Binance::FeedMessage msg;
+    while (depthSub_.pop(msg)) {
+        worked = true;
+        if (msg.symbolId >= depthBooks_.size() || msg.payload.empty()) continue;
+
+        std::unique_ptr<DepthBook>& slot = depthBooks_[msg.symbolId];
+        if (!slot) slot = std::make_unique<DepthBook>();
+        DepthBook& depth = *slot;
+
+        switch (applyDepthMessage(msg.payload, depth.book)) {
+            case DepthApplyResult::Snapshot: {
+                // Replay what arrived before it; diffs it already covers come back Stale
+                size_t replayed = 0;
+                while (replayed < depth.buffered.size() &&
+                       applyDepthMessage(depth.buffered[replayed], depth.book) != DepthApplyResult::Gap) {
+                    ++replayed;
+                }
+                // A gap here means the snapshot predates the buffered diffs; keep them for the next one
+                depth.buffered.erase(depth.buffered.begin(), depth.buffered.begin() + replayed);
+                if (!depth.buffered.empty()) {
+                    logger_.logInfo(fmt::format("[WARN] Depth snapshot for {} is older than its buffered diffs", transport_.symbols().name(msg.symbolId)));
+                    requestResync(msg.symbolId, depth);
+                }
+                break;
+            }
+            case DepthApplyResult::Applied:
+                break;
+            case DepthApplyResult::Buffer:
+                if (depth.buffered.size() >= kMaxBufferedDiffs) depth.buffered.pop_front();
+                depth.buffered.push_back(std::move(msg.payload));
+                if (depth.buffered.size() >= kResyncAfterDiffs) requestResync(msg.symbolId, depth);
+                continue;
+            case DepthApplyResult::Gap:
+                // Book stops here; this diff and the following ones wait for the next snapshot
+                logger_.logInfo(fmt::format("[WARN] Depth gap for {} after update {}", transport_.symbols().name(msg.symbolId), depth.book.lastUpdateId()));
+                depth.buffered.push_back(std::move(msg.payload));
+                requestResync(msg.symbolId, depth);
+                break;
+            case DepthApplyResult::Stale:
+            case DepthApplyResult::Invalid:
+                continue;
+        }
+
+        if (!depth.changed) {
+            depth.changed = true;
+            changedBooks_.push_back(msg.symbolId);
+        }
+        dirty_ = true;
+    }
+    return worked;
+}
+
+void MarketDataPipeline::requestResync(SymbolId symbolId, DepthBook& depth) {
+    auto now = std::chrono::steady_clock::now();
+    if (now - depth.lastResync < kResyncInterval) return;
+    depth.lastResync = now;
+
+    std::lock_guard<std::mutex> lock(resyncMutex_);
+    resyncRequests_.push_back(symbolId);
+}
+
+// ------------------ Klines ------------------
+// REST backfill and pushed kline updates; the exchange's bars override what trades built
+bool MarketDataPipeline::drainKlines() {
+    bool worked = false;
+    Binance::FeedMessage kline_msg;
+    while (klineSub_.pop(kline_msg)) {
+        worked = true;
+        decodedKlines_.clear();
+        size_t closed = 0;
+        if (decodeToKlines(kline_msg.payload, decodedKlines_, &closed) == 0) continue;
+        // One message is one REST page or one pushed candle, i.e. one unbroken run
+        if (klineCache_) klineCache_->append(decodedKlines_, closed);
+
+        for (size_t i = 0; i < aggregators_.size(); ++i) {
+            if (aggregators_[i].mergeBars(decodedKlines_)) dirty_ = true;
+        }
+    }
+    return worked;
+}
+
+// ------------------ Trades ------------------
+bool MarketDataPipeline::drainTrades() {
+    bool worked = false;
+    Binance::FeedMessage trade_msg;
+    TradeData trade;
+    while (tradeSub_.pop(trade_msg)) {
+        worked = true;
+        if (!decodeToTrade(trade_msg.payload, trade)) continue;
+
+        for (size_t i = 0; i < aggregators_.size(); ++i) {
+            if (aggregators_[i].addTrade(trade.trade_time, trade.price, trade.quantity)) dirty_ = true;
+        }
+    }
+    return worked;
+}
+
+// Close bars on time boundaries even when no trade arrives to do it
+void MarketDataPipeline::advanceBars() {
+    uint64_t nowMs = wallClockMs();
+    for (size_t i = 0; i < aggregators_.size(); ++i) {
+        if (aggregators_[i].advanceTo(nowMs)) dirty_ = true;
+    }
+}
+
+// ------------------ Latency ------------------
+bool MarketDataPipeline::drainLatency() {
+    bool worked = false;
+    Binance::FeedMessage latency_pair;
+    while (latencySub_.pop(latency_pair)) {
+        worked = true;
+        const std::vector<uint8_t>& latency_msg = latency_pair.payload; // ignore topic
+        std::string str_msg(latency_msg.begin(), latency_msg.end());
+        auto space_pos = str_msg.find(' ');
+        if (space_pos != std::string::npos) {
+            working_.latencyMessage = str_msg.substr(space_pos + 1);
+            dirty_ = true;
+        }
+    }
+    return worked;
+}
+
+// ------------------ Native feed ------------------
+// Same handling as the ZMQ routes, minus the FlatBuffers decode: the feed hands over
+// finished structs. A bookticker lands straight in the working snapshot.
+bool MarketDataPipeline::drainNativeFeed() {
+    bool worked = false;
+
+    BBO bbo;
+    while (nativeFeed_->bookTickers().pop(bbo)) {
+        worked = true;
+        latestBBOs_[bbo.symbol] = bbo;
+        bbosChanged_ = true;
+        dirty_ = true;
+    }
+
+    Binance::WsKline kline;
+    while (nativeFeed_->klines().pop(kline)) {
+        worked = true;
+        decodedKlines_.assign(1, kline.kline);
+        if (klineCache_) klineCache_->append(decodedKlines_, kline.closed ? 1 : 0);
+        for (size_t i = 0; i < aggregators_.size(); ++i) {
+            if (aggregators_[i].mergeBars(decodedKlines_)) dirty_ = true;
+        }
+    }
+
+    Binance::WsTrade trade;
+    while (nativeFeed_->trades().pop(trade)) {
+        worked = true;
+        for (size_t i = 0; i < aggregators_.size(); ++i) {
+            if (aggregators_[i].addTrade(trade.trade.trade_time, trade.trade.price, trade.trade.quantity)) dirty_ = true;
+        }
+    }
+    return worked;
+}
+
+// Decode the pending payloads and swap in a fresh immutable snapshot. Only the parts
+// that changed since the last publish are copied; the rest are shared by pointer.
+void MarketDataPipeline::publish() {
+    for (SymbolId symbolId : pendingSymbols_) {
+        std::vector<uint8_t>& payload = pendingBookTickers_[symbolId];
+        latestBBOs_[symbolId] = decodeToBBO(payload, symbolId, logger_);
+        payload.clear();
+        bbosChanged_ = true;
+    }
+    pendingSymbols_.clear();
+    if (bbosChanged_) {
+        working_.latestBBOs = std::make_shared<const BBOMap>(latestBBOs_);
+        bbosChanged_ = false;
+    }
+
+    for (SymbolId symbolId : changedBooks_) {
+        DepthBook& depth = *depthBooks_[symbolId];
+        OrderBookView& view = books_[symbolId];
+        depth.book.topLevels(kBookViewLevels, view.bids, view.asks);
+        view.lastUpdateId = depth.book.lastUpdateId();
+        view.state = depth.book.state();
+        depth.changed = false;
+    }
+    if (!changedBooks_.empty()) working_.books = std::make_shared<const BookViewMap>(books_);
+    changedBooks_.clear();
+
+    // A changed series takes only the changed suffix (higher timeframes only redo the
+    // buckets the 1m change reaches) and copies just the chunk it lands in; the previous
+    // snapshot keeps its chunks, the others are shared with it
+    for (size_t i = 0; i < aggregators_.size(); ++i) {
+        CandleChange change = aggregators_[i].takeChange();
+        if (i == kTf1m) resampler_.update(aggregators_[i].bars(), change);
+        if (working_.bars[i].applyChange(aggregators_[i].bars(), change)) working_.barsVersion[i]++;
+    }
+    for (size_t tf = 0; tf < resampler_.timeframeCount(); ++tf) {
+        if (working_.bars[kTf5m + tf].applyChange(resampler_.bars(tf), resampler_.takeChange(tf))) working_.barsVersion[kTf5m + tf]++;
+    }
+
+    working_.version++;
+    auto next = std::make_shared<const MarketSnapshot>(working_);
+    {
+        std::lock_guard<std::mutex> lock(snapshotMutex_);
+        snapshot_ = std::move(next);
+    }
+    dirty_ = false;
+}
+
+} // namespace NikTrade
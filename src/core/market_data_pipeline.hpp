@@ -0,0 +1,147 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "core/BBO.hpp"
+#include "core/BinanceBookTickerDecoder.hpp"
+#include "core/bar_series.hpp"
+#include "core/order_book.hpp"
+#include "core/bar_aggregator.hpp"
+#include "core/timeframe_resampler.hpp"
+#include "core/symbol_registry.hpp"
+#include "core/binance_kline.hpp"
+#include "core/kline_cache.hpp"
+#include "core/net/zmq_transport.hpp"
+#include "core/net/binance_ws_feed.hpp"
+#include "utils/file_logger.hpp"
+
+namespace NikTrade {
+
+using BBOMap = std::unordered_map<SymbolId, BBO>;
+using BookViewMap = std::unordered_map<SymbolId, OrderBookView>;
+
+// Decoded, ready-to-render market state. Immutable once published.
+// The parts sit behind their own pointers (never null), and the bar series share
+// their chunks, so a publish shares whatever did not change with the previous
+// snapshot instead of copying it.
+struct MarketSnapshot {
+    std::shared_ptr<const BBOMap> latestBBOs = std::make_shared<const BBOMap>();     // Only symbols that have received data
+    std::shared_ptr<const BookViewMap> books = std::make_shared<const BookViewMap>(); // Top levels of every depth book
+    std::array<BarSeries, kTimeframeCount> bars;             // Indexed by ChartTimeframe, oldest first
+    std::array<uint64_t, kTimeframeCount> barsVersion{};     // Bumped when that timeframe's bars change
+    std::string latencyMessage = "Latency: Loading...";
+    uint64_t version = 0;                            // Bumped on every publish
+};
+
+// Market-data stage between the ZMQ subscribers and the UI.
+// Drains the subscriber queues on its own thread, decodes the FlatBuffers payloads
+// and publishes immutable snapshots (RCU style) that the render loop only reads.
+class MarketDataPipeline {
+public:
+    MarketDataPipeline(Binance::ZMQTransport& transport,
+                       Binance::ZMQSubscriber& bookTickerSub,
+                       Binance::ZMQSubscriber& bookTickerBatchSub,
+                       Binance::ZMQSubscriber& depthSub,
+                       Binance::ZMQSubscriber& klineSub,
+                       Binance::ZMQSubscriber& tradeSub,
+                       Binance::ZMQSubscriber& latencySub,
+                       FileLogger& logger,
+                       size_t maxBars = 500);
+    ~MarketDataPipeline();
+
+    MarketDataPipeline(const MarketDataPipeline&) = delete;
+    MarketDataPipeline& operator=(const MarketDataPipeline&) = delete;
+
+    // Also drain an in-process websocket feed (already decoded). Must be called before start();
+    // the feed's onData should wake the transport (ZMQTransport::notifyData) so the pipeline
+    // does not sleep through its messages.
+    void attachNativeFeed(Binance::BinanceWsFeed& feed);
+
+    // Persist the chart's closed exchange klines (REST pages and pushed updates) to `cache`.
+    // Must be called before start(); the cache's interval must be 1m.
+    void attachKlineCache(KlineSeriesCache& cache);
+
+    // Chart bars to start from before any kline arrives (e.g. read back from the cache).
+    // Must be called before start().
+    void seedKlines(const std::vector<KlineData>& klines);
+
+    void start();
+    void stop() noexcept;
+
+    // Latest published snapshot (never null). Safe to call from any thread;
+    // the returned snapshot stays valid for as long as the caller holds it.
+    std::shared_ptr<const MarketSnapshot> snapshot() const;
+
+    // Symbols whose depth book needs a fresh snapshot (gap detected or none received).
+    // Appends to `out`; the caller asks the publisher for a snapshot of each.
+    void takeDepthResyncs(std::vector<SymbolId>& out);
+
+private:
+    // Book for one symbol plus the diffs received while it waits for a snapshot
+    struct DepthBook {
+        OrderBook book;
+        std::deque<std::vector<uint8_t>> buffered;
+        std::chrono::steady_clock::time_point lastResync{};
+        bool changed = false;
+    };
+
+    void run();
+    bool drainBookTickers();
+    bool drainBookTickerBatches();
+    bool drainDepth();
+    void requestResync(SymbolId symbolId, DepthBook& depth);
+    bool drainKlines();
+    bool drainTrades();
+    void advanceBars();
+    bool drainLatency();
+    bool drainNativeFeed();
+    void publish();
+
+    Binance::ZMQTransport& transport_;
+    Binance::ZMQSubscriber& bookTickerSub_;
+    Binance::ZMQSubscriber& bookTickerBatchSub_;
+    Binance::ZMQSubscriber& depthSub_;
+    Binance::ZMQSubscriber& klineSub_;
+    Binance::ZMQSubscriber& tradeSub_;
+    Binance::ZMQSubscriber& latencySub_;
+    FileLogger& logger_;
+    Binance::BinanceWsFeed* nativeFeed_ = nullptr;
+    KlineSeriesCache* klineCache_ = nullptr;
+
+    // Pipeline-thread state
+    MarketSnapshot working_;                               // Next snapshot; parts are swapped in as they change
+    BBOMap latestBBOs_;                                    // Mutable originals of the snapshot parts
+    BookViewMap books_;
+    bool bbosChanged_ = false;
+    std::vector<std::vector<uint8_t>> pendingBookTickers_; // Latest raw payload per SymbolId since last publish
+    std::vector<SymbolId> pendingSymbols_;                 // Ids with a non-empty pending payload
+    std::vector<std::unique_ptr<DepthBook>> depthBooks_;   // Indexed by SymbolId, created on first depth message
+    std::vector<SymbolId> changedBooks_;                   // Books touched since last publish
+    std::vector<KlineData> decodedKlines_;                 // Reused decode scratch
+    std::vector<BatchedQuote> decodedQuotes_;              // Reused decode scratch
+    std::vector<uint64_t> lastQuoteNs_;                    // Publisher receive time of the last batched quote, per SymbolId
+    bool warnedBadBatch_ = false;
+    std::vector<BarAggregator> aggregators_;               // kTf1s and kTf1m, built from trades/klines
+    TimeframeResampler resampler_;                         // kTf5m.. derived from the 1m bars
+    bool dirty_ = false;
+    std::chrono::steady_clock::time_point lastPublish_{};
+
+    // Published state
+    mutable std::mutex snapshotMutex_; // Guards the pointer swap only
+    std::shared_ptr<const MarketSnapshot> snapshot_;
+
+    std::mutex resyncMutex_;
+    std::vector<SymbolId> resyncRequests_;
+
+    std::atomic<bool> running_{false};
+    std::thread workerThread_;
+};
+
+} // namespace NikTrade
@@ -0,0 +1,367 @@
+#include "binance_ws_feed.hpp"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <deque>
+#include <optional>
+#include <type_traits>
+#include <boost/asio/connect.hpp>
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/ssl.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/beast/core.hpp>
+#include <boost/beast/ssl.hpp>
+#include <boost/beast/websocket.hpp>
+#include <boost/beast/websocket/ssl.hpp>
+#include <fmt/core.h>
+#include "core/BinanceJsonDecoder.hpp"
+
+namespace Binance {
+
+namespace net = boost::asio;
+namespace beast = boost::beast;
+namespace websocket = beast::websocket;
+namespace ssl = net::ssl;
+using tcp = net::ip::tcp;
+
+namespace {
+
+struct SessionHandlers {
+    std::function<void()> onOpen;
+    std::function<void(std::string_view)> onMessage;
+    std::function<void(beast::error_code, const char*)> onClosed; // Called once, with the failing stage
+};
+
+// One connection attempt: resolve -> connect -> (TLS) -> websocket handshake -> read loop.
+// Reconnects create a new session. Every member runs on the I/O thread.
+class WsSession {
+public:
+    virtual ~WsSession() = default;
+    virtual void run(const std::string& path) = 0;
+    virtual void send(std::string frame) = 0; // Held back until the handshake completes
+};
+
+template <bool Tls>
+class WsSessionImpl : public WsSession, public std::enable_shared_from_this<WsSessionImpl<Tls>> {
+    using Stream = std::conditional_t<Tls,
+                                      websocket::stream<beast::ssl_stream<beast::tcp_stream>>,
+                                      websocket::stream<beast::tcp_stream>>;
+
+public:
+    WsSessionImpl(net::io_context& ioc, ssl::context& tls, const WsFeedConfig& config, SessionHandlers handlers)
+        : resolver_(ioc), config_(config), handlers_(std::move(handlers))
+    {
+        if constexpr (Tls) ws_.emplace(ioc, tls);
+        else ws_.emplace(ioc);
+    }
+
+    void run(const std::string& path) override {
+        path_ = path;
+        resolver_.async_resolve(config_.host, config_.port,
+            [self = this->shared_from_this()](beast::error_code ec, tcp::resolver::results_type results) {
+                self->onResolve(ec, results);
+            });
+    }
+
+    void send(std::string frame) override {
+        writes_.push_back(std::move(frame));
+        if (open_ && writes_.size() == 1) doWrite();
+    }
+
+private:
+    void onResolve(beast::error_code ec, const tcp::resolver::results_type& results) {
+        if (ec) return fail(ec, "resolve");
+        beast::get_lowest_layer(*ws_).expires_after(std::chrono::seconds(10));
+        beast::get_lowest_layer(*ws_).async_connect(results,
+            [self = this->shared_from_this()](beast::error_code ec, const tcp::endpoint&) {
+                self->onConnect(ec);
+            });
+    }
+
+    void onConnect(beast::error_code ec) {
+        if (ec) return fail(ec, "connect");
+        if constexpr (Tls) {
+            auto& tlsStream = ws_->next_layer();
+            // SNI + certificate host check
+            if (!SSL_set_tlsext_host_name(tlsStream.native_handle(), config_.host.c_str())) {
+                return fail(beast::error_code(static_cast<int>(::ERR_get_error()), net::error::get_ssl_category()), "sni");
+            }
+            tlsStream.set_verify_callback(ssl::host_name_verification(config_.host));
+            tlsStream.async_handshake(ssl::stream_base::client,
+                [self = this->shared_from_this()](beast::error_code ec) {
+                    if (ec) return self->fail(ec, "tls handshake");
+                    self->handshake();
+                });
+        } else {
+            handshake();
+        }
+    }
+
+    void handshake() {
+        // The websocket layer takes over timeouts (and keep-alive pings) from here
+        beast::get_lowest_layer(*ws_).expires_never();
+        ws_->set_option(websocket::stream_base::timeout::suggested(beast::role_type::client));
+        ws_->async_handshake(config_.host + ":" + config_.port, path_,
+            [self = this->shared_from_this()](beast::error_code ec) {
+                if (ec) return self->fail(ec, "handshake");
+                self->open_ = true;
+                self->handlers_.onOpen();
+                if (!self->writes_.empty()) self->doWrite();
+                self->doRead();
+            });
+    }
+
+    void doRead() {
+        ws_->async_read(buffer_, [self = this->shared_from_this()](beast::error_code ec, size_t) {
+            if (ec) return self->fail(ec, "read");
+            auto data = self->buffer_.cdata();
+            self->handlers_.onMessage(std::string_view(static_cast<const char*>(data.data()), data.size()));
+            self->buffer_.consume(self->buffer_.size());
+            self->doRead();
+        });
+    }
+
+    void doWrite() {
+        ws_->text(true);
+        ws_->async_write(net::buffer(writes_.front()), [self = this->shared_from_this()](beast::error_code ec, size_t) {
+            if (ec) return self->fail(ec, "write");
+            self->writes_.pop_front();
+            if (!self->writes_.empty()) self->doWrite();
+        });
+    }
+
+    void fail(beast::error_code ec, const char* stage) {
+        if (failed_) return;
+        failed_ = true;
+        open_ = false;
+        handlers_.onClosed(ec, stage);
+    }
+
+    tcp::resolver resolver_;
+    std::optional<Stream> ws_;
+    const WsFeedConfig& config_;
+    SessionHandlers handlers_;
+    std::string path_;
+    beast::flat_buffer buffer_;
+    std::deque<std::string> writes_;
+    bool open_ = false;
+    bool failed_ = false;
+};
+
+constexpr auto kMinBackoff = std::chrono::seconds(1);
+constexpr auto kMaxBackoff = std::chrono::seconds(30);
+
+} // namespace
+
+struct BinanceWsFeed::IoState {
+    net::io_context ioc{1};
+    std::optional<net::executor_work_guard<net::io_context::executor_type>> work;
+    ssl::context tls{ssl::context::tlsv12_client};
+    net::steady_timer reconnectTimer{ioc};
+    std::shared_ptr<WsSession> session; // Null while disconnected
+    std::chrono::seconds backoff = kMinBackoff;
+};
+
+WsFeedConfig wsFeedConfigFromUrl(const std::string& url) {
+    WsFeedConfig config;
+    std::string_view rest = url;
+    if (rest.substr(0, 6) == "wss://") { config.tls = true; rest.remove_prefix(6); }
+    else if (rest.substr(0, 5) == "ws://") { config.tls = false; config.port = "80"; rest.remove_prefix(5); }
+
+    size_t slash = rest.find('/');
+    std::string_view authority = rest.substr(0, slash);
+    if (slash != std::string_view::npos) config.path = std::string(rest.substr(slash));
+
+    size_t colon = authority.find(':');
+    if (colon != std::string_view::npos) {
+        config.port = std::string(authority.substr(colon + 1));
+        authority = authority.substr(0, colon);
+    }
+    if (!authority.empty()) config.host = std::string(authority);
+    return config;
+}
+
+BinanceWsFeed::BinanceWsFeed(const SymbolRegistry& symbols, WsFeedConfig config, FileLogger& logger,
+                             std::function<void()> onData)
+    : symbols_(symbols),
+      config_(std::move(config)),
+      logger_(logger),
+      onData_(std::move(onData)),
+      bookTickers_(config_.queueCapacity),
+      klines_(config_.queueCapacity),
+      trades_(config_.queueCapacity),
+      io_(std::make_unique<IoState>())
+{
+}
+
+BinanceWsFeed::~BinanceWsFeed() {
+    stop();
+}
+
+void BinanceWsFeed::start() {
+    if (running_.exchange(true)) return;
+
+    if (config_.tls) {
+        io_->tls.set_default_verify_paths();
+        io_->tls.set_verify_mode(ssl::verify_peer);
+    }
+    io_->work.emplace(net::make_work_guard(io_->ioc));
+    ioThread_ = std::thread([this] {
+        net::post(io_->ioc, [this] { connect(); });
+        io_->ioc.run();
+    });
+    logger_.logInfo(fmt::format("[INFO] Native feed using {}://{}:{}{}",
+                                config_.tls ? "wss" : "ws", config_.host, config_.port, config_.path));
+}
+
+void BinanceWsFeed::stop() noexcept {
+    if (!running_.exchange(false)) return;
+    // Dropping the connection without a close handshake is fine for a market-data stream
+    io_->ioc.stop();
+    if (ioThread_.joinable()) ioThread_.join();
+    io_->session.reset();
+    connected_.store(false);
+}
+
+// ------------------ Subscriptions ------------------
+std::string BinanceWsFeed::streamName(SymbolId symbol, WsStream stream) const {
+    std::string name = symbols_.name(symbol);
+    std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    switch (stream) {
+        case kWsBookTicker: return name + "@bookTicker";
+        case kWsKline1m:    return name + "@kline_1m";
+        case kWsTrade:      return name + "@trade";
+    }
+    return name;
+}
+
+void BinanceWsFeed::subscribe(SymbolId symbol, unsigned streams) {
+    if (!symbols_.contains(symbol)) return;
+    std::vector<std::string> added;
+    {
+        std::lock_guard<std::mutex> lock(streamsMutex_);
+        for (WsStream stream : {kWsBookTicker, kWsKline1m, kWsTrade}) {
+            if (!(streams & stream)) continue;
+            std::string name = streamName(symbol, stream);
+            if (streams_[name]++ == 0) added.push_back(std::move(name));
+        }
+    }
+    if (added.empty() || !running_.load()) return;
+
+    net::post(io_->ioc, [this, added = std::move(added)] {
+        // Not connected yet: the connect path will carry every stream
+        if (!io_->session) return connect();
+        for (const std::string& stream : added) sendStreamChange("SUBSCRIBE", stream);
+    });
+}
+
+void BinanceWsFeed::unsubscribe(SymbolId symbol, unsigned streams) {
+    if (!symbols_.contains(symbol)) return;
+    std::vector<std::string> removed;
+    {
+        std::lock_guard<std::mutex> lock(streamsMutex_);
+        for (WsStream stream : {kWsBookTicker, kWsKline1m, kWsTrade}) {
+            if (!(streams & stream)) continue;
+            auto it = streams_.find(streamName(symbol, stream));
+            if (it == streams_.end()) continue;
+            if (--it->second == 0) {
+                removed.push_back(it->first);
+                streams_.erase(it);
+            }
+        }
+    }
+    if (removed.empty() || !running_.load()) return;
+
+    net::post(io_->ioc, [this, removed = std::move(removed)] {
+        if (!io_->session) return;
+        for (const std::string& stream : removed) sendStreamChange("UNSUBSCRIBE", stream);
+    });
+}
+
+void BinanceWsFeed::sendStreamChange(const char* method, const std::string& stream) {
+    io_->session->send(fmt::format(R"({{"method":"{}","params":["{}"],"id":{}}})", method, stream, nextRequestId_++));
+}
+
+std::string BinanceWsFeed::connectPath() {
+    std::lock_guard<std::mutex> lock(streamsMutex_);
+    if (streams_.empty()) return {};
+    std::string path = config_.path + "?streams=";
+    bool first = true;
+    for (const auto& [stream, refs] : streams_) {
+        if (!first) path += '/';
+        path += stream;
+        first = false;
+    }
+    return path;
+}
+
+// ------------------ Connection ------------------
+void BinanceWsFeed::connect() {
+    if (!running_.load() || io_->session) return;
+    std::string path = connectPath();
+    if (path.empty()) return; // Nothing to stream yet; subscribe() connects later
+
+    SessionHandlers handlers;
+    handlers.onOpen = [this] {
+        connected_.store(true);
+        io_->backoff = kMinBackoff;
+        logger_.logInfo("[INFO] Native feed connected.");
+    };
+    handlers.onMessage = [this](std::string_view message) { handleMessage(message); };
+    handlers.onClosed = [this](beast::error_code ec, const char* stage) {
+        connected_.store(false);
+        logger_.logInfo(fmt::format("[WARN] Native feed {} failed: {}", stage, ec.message()));
+        io_->session.reset();
+        scheduleReconnect();
+    };
+
+    if (config_.tls) io_->session = std::make_shared<WsSessionImpl<true>>(io_->ioc, io_->tls, config_, std::move(handlers));
+    else io_->session = std::make_shared<WsSessionImpl<false>>(io_->ioc, io_->tls, config_, std::move(handlers));
+    io_->session->run(path);
+}
+
+void BinanceWsFeed::scheduleReconnect() {
+    if (!running_.load()) return;
+    io_->reconnectTimer.expires_after(io_->backoff);
+    io_->reconnectTimer.async_wait([this](beast::error_code ec) {
+        if (!ec) connect();
+    });
+    io_->backoff = std::min(io_->backoff * 2, std::chrono::seconds(kMaxBackoff));
+}
+
+// ------------------ Decoding ------------------
+void BinanceWsFeed::handleMessage(std::string_view message) {
+    std::string_view data;
+    bool queued = false;
+    switch (classifyBinanceJson(message, data)) {
+        case BinanceJsonEvent::BookTicker: {
+            BBO bbo;
+            if (decodeBookTickerJson(data, symbols_, bbo)) queued = bookTickers_.push(bbo);
+            else decodeErrors_.fetch_add(1, std::memory_order_relaxed);
+            break;
+        }
+        case BinanceJsonEvent::Kline: {
+            WsKline kline;
+            if (decodeKlineJson(data, symbols_, kline.symbol, kline.kline, kline.closed)) queued = klines_.push(kline);
+            else decodeErrors_.fetch_add(1, std::memory_order_relaxed);
+            break;
+        }
+        case BinanceJsonEvent::Trade: {
+            WsTrade trade;
+            if (decodeTradeJson(data, symbols_, trade.symbol, trade.trade)) queued = trades_.push(trade);
+            else decodeErrors_.fetch_add(1, std::memory_order_relaxed);
+            break;
+        }
+        case BinanceJsonEvent::Other:
+            break; // Subscription acks
+        case BinanceJsonEvent::Invalid:
+            decodeErrors_.fetch_add(1, std::memory_order_relaxed);
+            break;
+    }
+    if (queued && onData_) onData_();
+}
+
+} // namespace Binance
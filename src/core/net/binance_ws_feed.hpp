@@ -0,0 +1,111 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include "core/BBO.hpp"
+#include "core/binance_kline.hpp"
+#include "core/trade.hpp"
+#include "core/symbol_registry.hpp"
+#include "core/net/feed_queue.hpp"
+#include "utils/file_logger.hpp"
+
+namespace Binance {
+
+struct WsFeedConfig {
+    std::string host = "stream.binance.us";
+    std::string port = "9443";
+    std::string path = "/stream"; // Combined-stream endpoint
+    bool tls = true;
+    size_t queueCapacity = 65536; // Per queue
+};
+
+// "wss://host:port/path" or "ws://host:port/path" (e.g. a local stand-in);
+// unspecified parts keep their defaults
+WsFeedConfig wsFeedConfigFromUrl(const std::string& url);
+
+// Streams a symbol can be subscribed to (bit flags)
+enum WsStream : unsigned {
+    kWsBookTicker = 1u << 0, // <symbol>@bookTicker
+    kWsKline1m    = 1u << 1, // <symbol>@kline_1m
+    kWsTrade      = 1u << 2  // <symbol>@trade
+};
+
+struct WsKline {
+    SymbolId symbol = kInvalidSymbolId;
+    KlineData kline;
+    bool closed = false; // Final; until then the exchange keeps updating the candle
+};
+
+struct WsTrade {
+    SymbolId symbol = kInvalidSymbolId;
+    TradeData trade;
+};
+
+// In-process Binance websocket feed: one combined-stream connection on its own I/O
+// thread, JSON decoded straight into the numeric structs. Replaces the
+// websocket -> Python -> FlatBuffers -> ZMQ hop for the streams it carries.
+//
+// Output goes to typed queues drained by one consumer (the market-data pipeline),
+// like the ZMQSubscriber queues. Reconnects with backoff and resubscribes on its own.
+class BinanceWsFeed {
+public:
+    // `onData` runs on the I/O thread after items are queued (e.g. to wake the consumer)
+    BinanceWsFeed(const SymbolRegistry& symbols, WsFeedConfig config, FileLogger& logger,
+                  std::function<void()> onData = {});
+    ~BinanceWsFeed();
+
+    BinanceWsFeed(const BinanceWsFeed&) = delete;
+    BinanceWsFeed& operator=(const BinanceWsFeed&) = delete;
+
+    void start();
+    void stop() noexcept;
+
+    // Reference counted per stream; safe from any thread. Connects lazily on the
+    // first subscription.
+    void subscribe(SymbolId symbol, unsigned streams);
+    void unsubscribe(SymbolId symbol, unsigned streams);
+
+    FeedQueue<BBO>& bookTickers() { return bookTickers_; }
+    FeedQueue<WsKline>& klines() { return klines_; }
+    FeedQueue<WsTrade>& trades() { return trades_; }
+
+    bool connected() const { return connected_.load(std::memory_order_relaxed); }
+    uint64_t decodeErrors() const { return decodeErrors_.load(std::memory_order_relaxed); }
+
+private:
+    struct IoState; // Boost.Asio/Beast state, kept out of this header
+
+    void connect();                         // I/O thread
+    void scheduleReconnect();               // I/O thread
+    void handleMessage(std::string_view message);
+    void sendStreamChange(const char* method, const std::string& stream);
+    std::string streamName(SymbolId symbol, WsStream stream) const;
+    std::string connectPath();              // Path with every current stream
+
+    const SymbolRegistry& symbols_;
+    WsFeedConfig config_;
+    FileLogger& logger_;
+    std::function<void()> onData_;
+
+    FeedQueue<BBO> bookTickers_;
+    FeedQueue<WsKline> klines_;
+    FeedQueue<WsTrade> trades_;
+
+    std::mutex streamsMutex_;
+    std::map<std::string, int> streams_;    // Stream name -> subscriber count
+    uint64_t nextRequestId_ = 1;            // I/O thread
+
+    std::unique_ptr<IoState> io_;
+    std::atomic<bool> running_{false};
+    std::atomic<bool> connected_{false};
+    std::atomic<uint64_t> decodeErrors_{0};
+    std::thread ioThread_;
+};
+
+} // namespace Binance
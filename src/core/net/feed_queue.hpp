@@ -0,0 +1,38 @@
+#pragma once
+
+#include <boost/lockfree/spsc_queue.hpp>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace Binance {
+
+// Typed single-producer/single-consumer queue for already-decoded feed data.
+// Same contract as ZMQSubscriber: the producer never blocks, a full queue drops
+// the newest item and counts it.
+template <typename T>
+class FeedQueue {
+public:
+    explicit FeedQueue(size_t capacity)
+        : queue_(std::make_unique<boost::lockfree::spsc_queue<T>>(capacity)) {}
+
+    FeedQueue(const FeedQueue&) = delete;
+    FeedQueue& operator=(const FeedQueue&) = delete;
+
+    bool push(const T& item) { // Producer thread only
+        if (queue_->push(item)) return true;
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    bool pop(T& item) { return queue_->pop(item); } // Consumer thread only
+
+    uint64_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+    size_t queued() const { return queue_->read_available(); } // Consumer thread only
+
+private:
+    std::unique_ptr<boost::lockfree::spsc_queue<T>> queue_;
+    std::atomic<uint64_t> dropped_{0};
+};
+
+} // namespace Binance
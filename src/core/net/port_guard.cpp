@@ -0,0 +1,186 @@
+#include "port_guard.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <fmt/core.h>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#include <iphlpapi.h>
+#include <windows.h>
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+#ifdef __linux__
+#include <dirent.h>
+#include <fstream>
+#include <sstream>
+#endif
+
+namespace NikTrade {
+
+// How long releasePorts waits for killed owners to let go of their sockets
+static constexpr auto kReleaseTimeout = std::chrono::milliseconds(1000);
+static constexpr auto kReleasePoll = std::chrono::milliseconds(10);
+
+bool portInUse(uint16_t port) {
+#ifdef _WIN32
+    WSADATA wsa;
+    if (WSAStartup(MAKEWORD(2, 2), &wsa) != 0) return false;
+    SOCKET probe = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (probe == INVALID_SOCKET) { WSACleanup(); return false; }
+#else
+    int probe = socket(AF_INET, SOCK_STREAM, 0);
+    if (probe < 0) return false;
+    // Same as libzmq's own listeners: a socket in TIME_WAIT doesn't block the bind
+    int reuse = 1;
+    setsockopt(probe, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+#endif
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    bool taken = bind(probe, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) != 0;
+
+#ifdef _WIN32
+    closesocket(probe);
+    WSACleanup();
+#else
+    close(probe);
+#endif
+    return taken;
+}
+
+#ifdef __linux__
+// Inodes of the listening sockets on `port` from /proc/net/tcp{,6}
+static std::vector<unsigned long> listeningInodes(uint16_t port) {
+    std::vector<unsigned long> inodes;
+    for (const char* table : {"/proc/net/tcp", "/proc/net/tcp6"}) {
+        std::ifstream in(table);
+        std::string line;
+        std::getline(in, line); // Header
+        while (std::getline(in, line)) {
+            // sl local_address rem_address st tx:rx tr:when retrnsmt uid timeout inode
+            std::istringstream fields(line);
+            std::string slot, local, remote, state, queues, timer, retransmits, uid, timeout;
+            unsigned long inode = 0;
+            fields >> slot >> local >> remote >> state >> queues >> timer >> retransmits >> uid >> timeout >> inode;
+            auto colon = local.rfind(':');
+            if (colon == std::string::npos || state != "0A") continue; // 0A = LISTEN
+            if (std::stoul(local.substr(colon + 1), nullptr, 16) == port && inode != 0) inodes.push_back(inode);
+        }
+    }
+    return inodes;
+}
+#endif
+
+std::vector<int> portOwners(uint16_t port) {
+    std::vector<int> pids;
+#ifdef _WIN32
+    ULONG size = 0;
+    GetExtendedTcpTable(nullptr, &size, FALSE, AF_INET, TCP_TABLE_OWNER_PID_LISTENER, 0);
+    std::vector<unsigned char> buffer(size);
+    auto* table = reinterpret_cast<MIB_TCPTABLE_OWNER_PID*>(buffer.data());
+    if (size == 0 || GetExtendedTcpTable(table, &size, FALSE, AF_INET, TCP_TABLE_OWNER_PID_LISTENER, 0) != NO_ERROR) {
+        return pids;
+    }
+    for (DWORD i = 0; i < table->dwNumEntries; ++i) {
+        if (ntohs(static_cast<u_short>(table->table[i].dwLocalPort)) == port) {
+            pids.push_back(static_cast<int>(table->table[i].dwOwningPid));
+        }
+    }
+#elif defined(__linux__)
+    std::vector<unsigned long> inodes = listeningInodes(port);
+    if (inodes.empty()) return pids;
+
+    // Match the socket inodes against every process's open descriptors
+    DIR* proc = opendir("/proc");
+    if (!proc) return pids;
+    while (dirent* entry = readdir(proc)) {
+        int pid = std::atoi(entry->d_name);
+        if (pid <= 0) continue;
+        std::string fdDir = fmt::format("/proc/{}/fd", pid);
+        DIR* fds = opendir(fdDir.c_str());
+        if (!fds) continue; // Gone, or not ours to inspect
+        bool owns = false;
+        while (dirent* fd = readdir(fds)) {
+            if (fd->d_name[0] == '.') continue;
+            char target[64];
+            ssize_t n = readlink(fmt::format("{}/{}", fdDir, fd->d_name).c_str(), target, sizeof(target) - 1);
+            unsigned long inode = 0;
+            if (n <= 0) continue;
+            target[n] = '\0';
+            if (std::sscanf(target, "socket:[%lu]", &inode) == 1 &&
+                std::find(inodes.begin(), inodes.end(), inode) != inodes.end()) {
+                owns = true;
+                break;
+            }
+        }
+        closedir(fds);
+        if (owns) pids.push_back(pid);
+    }
+    closedir(proc);
+#else
+    // No /proc (macOS/BSD): ask lsof, but only for a port the probe already found taken
+    std::string cmd = fmt::format("lsof -t -iTCP:{} -sTCP:LISTEN", port);
+    if (FILE* out = popen(cmd.c_str(), "r")) {
+        int pid;
+        while (std::fscanf(out, "%d", &pid) == 1) pids.push_back(pid);
+        pclose(out);
+    }
+#endif
+    return pids;
+}
+
+static void killProcess(int pid) {
+#ifdef _WIN32
+    if (HANDLE process = OpenProcess(PROCESS_TERMINATE, FALSE, static_cast<DWORD>(pid))) {
+        TerminateProcess(process, 1);
+        CloseHandle(process);
+    }
+#else
+    kill(pid, SIGKILL);
+#endif
+}
+
+std::vector<uint16_t> releasePorts(const std::vector<uint16_t>& ports, FileLogger& logger) {
+#ifdef _WIN32
+    const int self = static_cast<int>(GetCurrentProcessId());
+#else
+    const int self = static_cast<int>(getpid());
+#endif
+
+    std::vector<uint16_t> taken;
+    for (uint16_t port : ports) {
+        if (!portInUse(port)) continue;
+        taken.push_back(port);
+        for (int pid : portOwners(port)) {
+            if (pid == self) continue;
+            logger.logInfo(fmt::format("[INFO] Port {} held by PID {}; killing it", port, pid));
+            killProcess(pid);
+        }
+    }
+
+    // Killed sockets close asynchronously; give them a moment before reporting
+    const auto deadline = std::chrono::steady_clock::now() + kReleaseTimeout;
+    while (!taken.empty()) {
+        taken.erase(std::remove_if(taken.begin(), taken.end(), [](uint16_t port) { return !portInUse(port); }), taken.end());
+        if (taken.empty() || std::chrono::steady_clock::now() >= deadline) break;
+        std::this_thread::sleep_for(kReleasePoll);
+    }
+    for (uint16_t port : taken) logger.logInfo(fmt::format("[WARN] Port {} is still in use", port));
+    return taken;
+}
+
+} // namespace NikTrade
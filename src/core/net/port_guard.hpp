@@ -0,0 +1,23 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "utils/file_logger.hpp"
+
+namespace NikTrade {
+
+// Frees the feed ports a previous run left bound (e.g. the Python child of a crashed
+// app) without shelling out: a bind probe says whether a port is taken at all, and
+// only then is the owner looked up through the OS (/proc on Linux,
+// GetExtendedTcpTable on Windows) and killed.
+
+// True if 127.0.0.1:port can't be bound (TIME_WAIT leftovers don't count)
+bool portInUse(uint16_t port);
+
+// PIDs with a listening TCP socket on `port`
+std::vector<int> portOwners(uint16_t port);
+
+// Kills the owners of every taken port (never this process) and waits briefly for
+// the ports to come free; returns the ones that are still taken
+std::vector<uint16_t> releasePorts(const std::vector<uint16_t>& ports, FileLogger& logger);
+
+} // namespace NikTrade
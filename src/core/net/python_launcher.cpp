@@ -20,7 +20,8 @@ PythonLauncher::PythonLauncher(const std::string& scriptPath,
                                const std::string& pythonExecutable)
     : scriptPath_(scriptPath),
       args_(args),
-      pythonPath_(pythonExecutable.empty() ? "python" : pythonExecutable) {}
+      pythonPath_(pythonExecutable.empty() ? "python" : pythonExecutable),
+      readySocket_(readyContext_, ZMQ_PULL) {}
 
 PythonLauncher::~PythonLauncher() {
     stop();
@@ -29,9 +30,36 @@ PythonLauncher::~PythonLauncher() {
 
 bool PythonLauncher::isRunning() const { return running_; }
 
+bool PythonLauncher::ready() {
+    if (ready_) return true;
+    zmq::message_t message;
+    if (readySocket_.handle() && readySocket_.recv(message, zmq::recv_flags::dontwait)) ready_ = true;
+    return ready_;
+}
+
+std::chrono::milliseconds PythonLauncher::sinceStart() const {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime_);
+}
+
 void PythonLauncher::start() {
     if (running_) return;
     running_ = true;
+    startTime_ = std::chrono::steady_clock::now();
+
+    // Exported before the child is spawned so it inherits the variable
+    try {
+        readySocket_.set(zmq::sockopt::linger, 0);
+        readySocket_.bind("tcp://127.0.0.1:*");
+        std::string endpoint = readySocket_.get(zmq::sockopt::last_endpoint);
+#ifdef _WIN32
+        _putenv_s("NIKTRADE_READY_ENDPOINT", endpoint.c_str());
+#else
+        setenv("NIKTRADE_READY_ENDPOINT", endpoint.c_str(), 1);
+#endif
+    } catch (const zmq::error_t& e) {
+        std::cerr << "Readiness socket unavailable: " << e.what() << "\n";
+        readySocket_.close();
+    }
 
     workerThread_ = std::thread([this]() {
 #ifdef _WIN32
@@ -2,7 +2,9 @@
 #include <string>
 #include <vector>
 #include <atomic>
+#include <chrono>
 #include <thread>
+#include <zmq.hpp>
 
 namespace NikTrade {
 
@@ -19,6 +21,12 @@ public:
     void stop();    // Terminate Python process
     bool isRunning() const;
 
+    // Readiness handshake: start() binds a PULL socket on an ephemeral loopback port and
+    // exports it as NIKTRADE_READY_ENDPOINT; the publisher pushes "ready <pid>" once all
+    // its sockets are bound. Non-blocking poll, true from the first message on.
+    bool ready();
+    std::chrono::milliseconds sinceStart() const;
+
 private:
     std::string scriptPath_;
     std::vector<std::string> args_;
@@ -26,6 +34,12 @@ private:
     std::atomic<bool> running_{false};   // true if Python is running
     std::thread workerThread_;
 
+    // Own context: the launcher starts before the feed transport (and its context) exists
+    zmq::context_t readyContext_{1};
+    zmq::socket_t readySocket_;
+    bool ready_ = false;
+    std::chrono::steady_clock::time_point startTime_;
+
 #ifdef _WIN32
     void startWindows();
     void stopWindows();
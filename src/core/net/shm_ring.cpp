@@ -0,0 +1,203 @@
+#include "shm_ring.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <thread>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <ctime>
+#endif
+
+namespace Binance {
+
+static constexpr uint32_t kRingMagic = 0x42524B4E; // "NKRB"
+static constexpr uint32_t kRingVersion = 1;
+static constexpr size_t kClaimPosOffset = 64;
+static constexpr size_t kWritePosOffset = 72;
+static constexpr size_t kWakeSeqOffset = 128;
+static constexpr size_t kWaitersOffset = 132;
+static constexpr size_t kDataOffset = 256;
+static constexpr size_t kRecordHeaderSize = 16;
+static constexpr uint32_t kRecordData = 0;
+static constexpr uint32_t kRecordPad = 1;
+// Polls of writePos before parking; covers the gap between records of a burst
+static constexpr int kSpinPolls = 2000;
+
+template <typename T>
+static std::atomic_ref<T> field(uint8_t* base, size_t offset) {
+    return std::atomic_ref<T>(*reinterpret_cast<T*>(base + offset));
+}
+
+ShmRingReader::~ShmRingReader() {
+    close();
+}
+
+bool ShmRingReader::open(const std::string& path) {
+    close();
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                              nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+    LARGE_INTEGER fileSize{};
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= static_cast<LONGLONG>(kDataOffset)) {
+        CloseHandle(file);
+        return false;
+    }
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE, 0, 0, nullptr);
+    void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, 0) : nullptr;
+    if (!view) {
+        if (mapping) CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+    file_ = file;
+    mapping_ = mapping;
+    base_ = static_cast<uint8_t*>(view);
+    mappedSize_ = static_cast<size_t>(fileSize.QuadPart);
+#else
+    int fd = ::open(path.c_str(), O_RDWR);
+    if (fd < 0) return false;
+    struct stat st{};
+    if (fstat(fd, &st) != 0 || st.st_size <= static_cast<off_t>(kDataOffset)) {
+        ::close(fd);
+        return false;
+    }
+    // The reader writes only the waiters count, but the futex word needs a shared writable page
+    void* view = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (view == MAP_FAILED) return false;
+    base_ = static_cast<uint8_t*>(view);
+    mappedSize_ = static_cast<size_t>(st.st_size);
+#endif
+
+    // The writer stores the magic last, so a half-initialized file is rejected here
+    uint32_t magic, version;
+    std::memcpy(&magic, base_, sizeof(magic));
+    std::memcpy(&version, base_ + 4, sizeof(version));
+    std::memcpy(&capacity_, base_ + 8, sizeof(capacity_));
+    if (magic != kRingMagic || version != kRingVersion || capacity_ == 0 || capacity_ % 16 != 0 ||
+        kDataOffset + capacity_ > mappedSize_) {
+        close();
+        return false;
+    }
+    position_ = field<uint64_t>(base_, kWritePosOffset).load(std::memory_order_acquire);
+    return true;
+}
+
+void ShmRingReader::close() noexcept {
+    if (!base_) return;
+#ifdef _WIN32
+    UnmapViewOfFile(base_);
+    CloseHandle(static_cast<HANDLE>(mapping_));
+    CloseHandle(static_cast<HANDLE>(file_));
+    mapping_ = file_ = nullptr;
+#else
+    munmap(base_, mappedSize_);
+#endif
+    base_ = nullptr;
+    mappedSize_ = 0;
+    capacity_ = 0;
+}
+
+bool ShmRingReader::hasData() const {
+    return field<uint64_t>(base_, kWritePosOffset).load(std::memory_order_acquire) != position_;
+}
+
+void ShmRingReader::skipToWriter() {
+    overruns_++;
+    position_ = field<uint64_t>(base_, kWritePosOffset).load(std::memory_order_acquire);
+}
+
+bool ShmRingReader::peek(ShmRecord& record) {
+    if (!base_) return false;
+    for (;;) {
+        uint64_t writePos = field<uint64_t>(base_, kWritePosOffset).load(std::memory_order_acquire);
+        if (writePos == position_) return false;
+        // Lapped, or the publisher restarted and reset the ring
+        if (writePos < position_ || writePos - position_ > capacity_) {
+            skipToWriter();
+            return false;
+        }
+
+        uint64_t offset = position_ % capacity_;
+        const uint8_t* slot = base_ + kDataOffset + offset;
+        uint32_t header[4];
+        std::memcpy(header, slot, sizeof(header));
+        uint32_t size = header[0], kind = header[1], topicSize = header[2], payloadSize = header[3];
+
+        // Sizes can only be garbage if the writer already reused this slot
+        if (size < kRecordHeaderSize || size % 16 != 0 || size > capacity_ - offset ||
+            (kind == kRecordData && kRecordHeaderSize + uint64_t(topicSize) + payloadSize > size)) {
+            skipToWriter();
+            return false;
+        }
+        if (kind == kRecordPad) {
+            position_ += size;
+            continue;
+        }
+
+        record.topic = std::string_view(reinterpret_cast<const char*>(slot + kRecordHeaderSize), topicSize);
+        record.payload = slot + kRecordHeaderSize + topicSize;
+        record.payloadSize = payloadSize;
+        record.position = position_;
+        record.size = size;
+        return true;
+    }
+}
+
+bool ShmRingReader::consume(const ShmRecord& record) {
+    // Seqlock-style check: the bytes read are intact unless the writer has since
+    // claimed space that reaches back over them
+    std::atomic_thread_fence(std::memory_order_acquire);
+    uint64_t claimPos = field<uint64_t>(base_, kClaimPosOffset).load(std::memory_order_relaxed);
+    if (claimPos - record.position > capacity_) {
+        skipToWriter();
+        return false;
+    }
+    position_ = record.position + record.size;
+    return true;
+}
+
+void ShmRingReader::waitForWrite(std::chrono::microseconds timeout) {
+    if (!base_) {
+        std::this_thread::sleep_for(timeout);
+        return;
+    }
+    for (int i = 0; i < kSpinPolls; ++i) {
+        if (hasData()) return;
+    }
+
+#ifdef __linux__
+    // wakeSeq is read before the final check, so a record committed in between makes
+    // FUTEX_WAIT return at once instead of sleeping through it
+    auto wakeSeq = field<uint32_t>(base_, kWakeSeqOffset);
+    auto waiters = field<uint32_t>(base_, kWaitersOffset);
+    uint32_t seq = wakeSeq.load(std::memory_order_acquire);
+    if (hasData()) return;
+
+    timespec ts{};
+    ts.tv_sec = static_cast<time_t>(timeout.count() / 1'000'000);
+    ts.tv_nsec = static_cast<long>((timeout.count() % 1'000'000) * 1000);
+    waiters.fetch_add(1, std::memory_order_seq_cst);
+    // Shared (not FUTEX_PRIVATE) wait: the writer lives in another process
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(base_ + kWakeSeqOffset), FUTEX_WAIT, seq, &ts, nullptr, 0);
+    waiters.fetch_sub(1, std::memory_order_seq_cst);
+#else
+    // No cross-process futex; a short sleep bounds the added latency
+    std::this_thread::sleep_for(std::min(timeout, std::chrono::microseconds(200)));
+#endif
+}
+
+} // namespace Binance
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace Binance {
+
+// Shared-memory broadcast ring written by the Python publisher (python/shm_ring.py).
+// One writer, any number of readers, each with its own read position. The writer
+// never waits for readers: a reader that falls a full ring behind skips ahead and
+// counts the loss, the same way a slow ZMQ subscriber loses messages at its HWM.
+//
+// File layout (little endian, fixed offsets shared with the Python writer):
+//   0    u32 magic 'NKRB'      4  u32 version
+//   8    u64 capacity          data bytes, multiple of 16
+//   64   u64 claimPos          end of the record being written (set before writing it)
+//   72   u64 writePos          end of the last complete record (set after writing it)
+//   128  u32 wakeSeq           bumped after every record; futex word on Linux
+//   132  u32 waiters           readers parked on wakeSeq
+//   256  data[capacity]
+//
+// Record (16-byte aligned, never wraps; a pad record fills the tail instead):
+//   u32 recordSize, u32 kind (0 = data, 1 = pad), u32 topicSize, u32 payloadSize,
+//   topic bytes, payload bytes, zero padding
+//
+// The writer is plain Python and publishes writePos with an ordinary store, not a
+// release store. Only x86's total store order makes the record visible before the
+// position the reader's acquire load sees, so the ring is x86-only; elsewhere both
+// ends ignore NIKTRADE_SHM_RING and stay on ZMQ.
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+inline constexpr bool kShmRingSupported = true;
+#else
+inline constexpr bool kShmRingSupported = false;
+#endif
+
+struct ShmRecord {
+    std::string_view topic;
+    const uint8_t* payload = nullptr; // Points into the mapping; copy it before consume()
+    size_t payloadSize = 0;
+    uint64_t position = 0;
+    uint64_t size = 0;
+};
+
+class ShmRingReader {
+public:
+    ShmRingReader() = default;
+    ~ShmRingReader();
+
+    ShmRingReader(const ShmRingReader&) = delete;
+    ShmRingReader& operator=(const ShmRingReader&) = delete;
+
+    // Map an existing ring; false if the file is missing or not initialized yet.
+    // Reading starts at the current write position (no history).
+    bool open(const std::string& path);
+    void close() noexcept;
+    bool attached() const { return base_ != nullptr; }
+
+    // Next complete record, viewed in place. The view is only trustworthy once
+    // consume() confirms the writer did not lap it while it was being read.
+    bool peek(ShmRecord& record);
+    bool consume(const ShmRecord& record);
+
+    // Spin briefly, then park until the writer signals or `timeout` expires
+    void waitForWrite(std::chrono::microseconds timeout);
+
+    uint64_t overruns() const { return overruns_; } // Times the writer lapped this reader
+
+private:
+    bool hasData() const;
+    void skipToWriter();
+
+    uint8_t* base_ = nullptr;
+    size_t mappedSize_ = 0;
+    uint64_t capacity_ = 0;
+    uint64_t position_ = 0;
+    uint64_t overruns_ = 0;
+#ifdef _WIN32
+    void* file_ = nullptr;
+    void* mapping_ = nullptr;
+#endif
+};
+
+} // namespace Binance
@@ -1,59 +1,239 @@
 #include "zmq_control_client.hpp"
 #include "utils/file_logger.hpp"
-#include <iostream>
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <fmt/core.h>
+#include <utility>
 
-ZMQControlClient::ZMQControlClient(const std::string& endpoint)
-    : context_(1), socket_(context_, ZMQ_REQ)
+std::optional<Binance::ControlOp> controlOpFromCommand(std::string_view command) {
+    static constexpr std::array<std::pair<std::string_view, Binance::ControlOp>, 6> kCommands{{
+        {"start_stream", Binance::ControlOp_StartStream},
+        {"close_stream", Binance::ControlOp_CloseStream},
+        {"fire_klines", Binance::ControlOp_FireKlines},
+        {"subscribe_klines", Binance::ControlOp_SubscribeKlines},
+        {"start_trades", Binance::ControlOp_StartTrades},
+        {"depth_snapshot", Binance::ControlOp_DepthSnapshot},
+    }};
+    for (const auto& [name, op] : kCommands) {
+        if (name == command) return op;
+    }
+    return std::nullopt;
+}
+
+ZMQControlClient::ZMQControlClient(zmq::context_t& context, const std::string& endpoint)
+    : context_(context), socket_(context_, ZMQ_DEALER)
 {
+    // Requests still queued at shutdown are dropped, not flushed
+    socket_.set(zmq::sockopt::linger, 0);
     socket_.connect(endpoint);
 }
 
 ZMQControlClient::~ZMQControlClient() {
     socket_.close();
-    context_.close();
 }
 
 bool ZMQControlClient::requestHistoricalKlines(const std::string& symbol, FileLogger &logger, int timeoutMs) {
-    zmq::message_t request(symbol.c_str(), symbol.size());
-    if (!socket_.send(request, zmq::send_flags::none)) {
-        logger.logInfo("Failed to send request\n");
+    std::string reply;
+    return sendControlRequest(symbol, reply, logger, timeoutMs) && reply == "OK";
+}
+
+bool ZMQControlClient::sendControlRequest(const std::string& requestStr, std::string& replyStr, FileLogger &logger, int timeoutMs) {
+    const uint64_t id = nextId_++;
+    if (!sendRequest(id, requestStr.data(), requestStr.size())) {
+        logger.logInfo("Failed to send request: " + requestStr + "\n");
         return false;
     }
 
-    // Poll for a reply
-    zmq::pollitem_t items[] = { {socket_, 0, ZMQ_POLLIN, 0} };
-    zmq::poll(items, 1, timeoutMs);
+    if (awaitReply(id, replyStr, logger, timeoutMs)) return true;
 
-    if (items[0].revents & ZMQ_POLLIN) {
-        zmq::message_t reply;
-        socket_.recv(reply);
-        std::string replyStr(static_cast<char*>(reply.data()), reply.size());
-        return replyStr == "OK";
+    logger.logInfo("Timeout waiting for control reply: " + requestStr + "\n");
+    return false;
+}
+
+size_t ZMQControlClient::buildBatch(uint64_t id, const std::vector<ControlOperation>& operations,
+                                    flatbuffers::FlatBufferBuilder& builder,
+                                    std::vector<ControlOutcome>& outcomes, std::vector<size_t>& sentIndex) {
+    outcomes.assign(operations.size(), ControlOutcome{});
+    sentIndex.clear();
+    sentIndex.reserve(operations.size());
+
+    // Commands without a ControlOp fail locally; the rest go out in one request
+    std::vector<flatbuffers::Offset<Binance::ControlItem>> items;
+    items.reserve(operations.size());
+    for (size_t i = 0; i < operations.size(); ++i) {
+        std::optional<Binance::ControlOp> op = controlOpFromCommand(operations[i].command);
+        if (!op) {
+            outcomes[i].message = "unknown command " + operations[i].command;
+            continue;
+        }
+        items.push_back(Binance::CreateControlItemDirect(builder, *op, operations[i].symbol.c_str(),
+                                                          operations[i].startTime, operations[i].endTime));
+        sentIndex.push_back(i);
+    }
+    if (!items.empty()) {
+        Binance::FinishControlRequestBuffer(builder, Binance::CreateControlRequestDirect(builder, id, &items));
     }
+    return items.size();
+}
 
-    logger.logInfo("Timeout waiting for control reply\n");
-    return false;
+bool ZMQControlClient::parseBatchReply(const std::string& reply, const std::vector<size_t>& sentIndex,
+                                       std::vector<ControlOutcome>& outcomes, FileLogger& logger) {
+    auto failAll = [&](const std::string& reason) {
+        for (size_t i : sentIndex) outcomes[i].message = reason;
+        return false;
+    };
+
+    flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t*>(reply.data()), reply.size());
+    if (!verifier.VerifyBuffer<Binance::ControlReply>(Binance::ControlRequestIdentifier())) {
+        logger.logInfo("[WARN] Invalid control batch reply: " + reply.substr(0, 64) + "\n");
+        return failAll("invalid reply");
+    }
+    const auto* results = flatbuffers::GetRoot<Binance::ControlReply>(reply.data())->results();
+    if (!results || results->size() != sentIndex.size()) {
+        logger.logInfo("[WARN] Control batch reply has the wrong number of results\n");
+        return failAll("invalid reply");
+    }
+
+    for (size_t k = 0; k < sentIndex.size(); ++k) {
+        const Binance::ControlResult* result = results->Get(static_cast<flatbuffers::uoffset_t>(k));
+        ControlOutcome& outcome = outcomes[sentIndex[k]];
+        outcome.ok = result->status() == Binance::ControlStatus_Ok;
+        if (result->message()) outcome.message = result->message()->str();
+    }
+    return true;
 }
 
-bool ZMQControlClient::sendControlRequest(const std::string& requestStr, std::string& replyStr, FileLogger &logger, int timeoutMs) {
-    zmq::message_t request(requestStr.c_str(), requestStr.size());
+bool ZMQControlClient::sendControlBatch(const std::vector<ControlOperation>& operations,
+                                        std::vector<ControlOutcome>& outcomes, FileLogger& logger, int timeoutMs) {
+    const uint64_t id = nextId_++;
+    std::vector<size_t> sentIndex;
+    flatbuffers::FlatBufferBuilder builder(64 + 32 * operations.size());
+    size_t itemCount = buildBatch(id, operations, builder, outcomes, sentIndex);
+    if (itemCount == 0) return true;
 
-    if (!socket_.send(request, zmq::send_flags::none)) {
-        logger.logInfo("Failed to send request: " + requestStr + "\n");
+    auto failAll = [&](const std::string& reason) {
+        for (size_t i : sentIndex) outcomes[i].message = reason;
         return false;
+    };
+
+    if (!sendRequest(id, builder.GetBufferPointer(), builder.GetSize())) {
+        logger.logInfo(fmt::format("Failed to send control batch ({} items)\n", itemCount));
+        return failAll("send failed");
     }
 
-    // Poll for a reply
-    zmq::pollitem_t items[] = { {socket_, 0, ZMQ_POLLIN, 0} };
-    zmq::poll(items, 1, timeoutMs);
+    std::string reply;
+    if (!awaitReply(id, reply, logger, timeoutMs)) {
+        logger.logInfo(fmt::format("Timeout waiting for control batch reply ({} items)\n", itemCount));
+        return failAll("timeout");
+    }
+    return parseBatchReply(reply, sentIndex, outcomes, logger);
+}
+
+uint64_t ZMQControlClient::postControlBatch(const std::vector<ControlOperation>& operations, FileLogger& logger, bool keepReply) {
+    const uint64_t id = nextId_++;
+    PostedBatch batch;
+    batch.keepReply = keepReply;
+    flatbuffers::FlatBufferBuilder builder(64 + 32 * operations.size());
+    size_t itemCount = buildBatch(id, operations, builder, batch.outcomes, batch.sentIndex);
+    if (itemCount == 0) return 0;
+
+    if (!sendRequest(id, builder.GetBufferPointer(), builder.GetSize())) {
+        logger.logInfo(fmt::format("Failed to send control batch ({} items)\n", itemCount));
+        return 0;
+    }
+    posted_.emplace(id, std::move(batch));
+    // A batch whose reply never comes (publisher restarted) must not be kept forever
+    while (posted_.size() > kMaxPostedBatches) posted_.erase(posted_.begin());
+    return id;
+}
+
+bool ZMQControlClient::pollBatchReply(uint64_t id, std::vector<ControlOutcome>& outcomes, FileLogger& logger) {
+    for (;;) {
+        zmq::pollitem_t items[] = { {socket_, 0, ZMQ_POLLIN, 0} };
+        zmq::poll(items, 1, 0L);
+        if (!(items[0].revents & ZMQ_POLLIN)) break;
 
-    if (items[0].revents & ZMQ_POLLIN) {
-        zmq::message_t reply;
-        socket_.recv(reply);
-        replyStr = std::string(static_cast<char*>(reply.data()), reply.size());
+        uint64_t replyId = 0;
+        std::string reply, rawId;
+        if (!receiveReply(replyId, reply, rawId) || !storePostedReply(replyId, reply)) {
+            logger.logInfo(fmt::format("[WARN] Dropping stale control reply (id {}): {}\n", rawId, reply));
+        }
+    }
+
+    auto it = posted_.find(id);
+    if (it == posted_.end() || !it->second.replied) return false;
+    PostedBatch batch = std::move(it->second);
+    posted_.erase(it);
+    outcomes = std::move(batch.outcomes);
+    parseBatchReply(batch.reply, batch.sentIndex, outcomes, logger);
+    return true;
+}
+
+bool ZMQControlClient::storePostedReply(uint64_t id, std::string& replyStr) {
+    auto it = posted_.find(id);
+    if (it == posted_.end()) return false;
+    if (!it->second.keepReply) {
+        posted_.erase(it);
         return true;
     }
+    it->second.replied = true;
+    it->second.reply = std::move(replyStr);
+    return true;
+}
 
-    logger.logInfo("Timeout waiting for control reply: " + requestStr + "\n");
-    return false;
+bool ZMQControlClient::sendRequest(uint64_t id, const void* data, size_t size) {
+    const std::string idStr = std::to_string(id);
+
+    // Empty delimiter first, as REQ would add, so the server sees the usual envelope
+    return socket_.send(zmq::message_t(), zmq::send_flags::sndmore) &&
+           socket_.send(zmq::message_t(idStr.data(), idStr.size()), zmq::send_flags::sndmore) &&
+           socket_.send(zmq::message_t(data, size), zmq::send_flags::none);
+}
+
+bool ZMQControlClient::awaitReply(uint64_t id, std::string& replyStr, FileLogger& logger, int timeoutMs) {
+    using Clock = std::chrono::steady_clock;
+    const auto deadline = Clock::now() + std::chrono::milliseconds(timeoutMs);
+
+    for (;;) {
+        auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - Clock::now()).count();
+        if (remaining < 0) return false;
+
+        zmq::pollitem_t items[] = { {socket_, 0, ZMQ_POLLIN, 0} };
+        zmq::poll(items, 1, static_cast<long>(remaining));
+        if (!(items[0].revents & ZMQ_POLLIN)) return false;
+
+        uint64_t replyId = 0;
+        std::string reply, rawId;
+        bool wellFormed = receiveReply(replyId, reply, rawId);
+        if (wellFormed && replyId == id) {
+            replyStr = std::move(reply);
+            return true;
+        }
+        // Replies to posted batches are filed for their owner, not read as this one's
+        if (wellFormed && storePostedReply(replyId, reply)) continue;
+        logger.logInfo(fmt::format("[WARN] Dropping stale control reply (id {}, expected {}): {}\n",
+                                   rawId, id, reply));
+    }
+}
+
+bool ZMQControlClient::receiveReply(uint64_t& id, std::string& replyStr, std::string& rawId) {
+    // Drain the whole multipart reply: [empty][id][reply]
+    std::string frames[3];
+    size_t count = 0;
+    bool more = true;
+    while (more) {
+        zmq::message_t frame;
+        if (!socket_.recv(frame, zmq::recv_flags::none)) return false;
+        if (count < 3) frames[count] = frame.to_string();
+        ++count;
+        more = frame.more();
+    }
+
+    rawId = count > 1 ? frames[1] : "?";
+    replyStr = count > 2 ? std::move(frames[2]) : std::string();
+    if (count != 3 || !frames[0].empty()) return false;
+    const std::string& idStr = frames[1];
+    auto [end, ec] = std::from_chars(idStr.data(), idStr.data() + idStr.size(), id);
+    return ec == std::errc() && end == idStr.data() + idStr.size();
 }
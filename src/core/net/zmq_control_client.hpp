@@ -1,11 +1,42 @@
 #pragma once
+#include <cstdint>
+#include <map>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <vector>
 #include <zmq.hpp>
+#include "core/flatbuffers/Binance/binance_control_generated.h"
 #include "utils/file_logger.hpp"
 
+// DEALER client for the Python control server (ROUTER, port 5560).
+// Frames: [empty][correlation id][request] -> [empty][correlation id][reply]
+// The id lets a reply that shows up after its request timed out be recognized and
+// dropped, instead of being read as the answer to the next request (and unlike REQ,
+// a timeout doesn't leave the socket unable to send).
+//
+// The request is either "cmd symbol" text or a Binance::ControlRequest FlatBuffer
+// (binance_control.fbs) batching any number of operations into one round-trip.
+
+struct ControlOperation {
+    std::string command; // Text command name, e.g. "start_stream"
+    std::string symbol;
+    uint64_t startTime = 0; // Kline ops: open_time range to backfill (ms), 0 = unbounded
+    uint64_t endTime = 0;
+};
+
+struct ControlOutcome {
+    bool ok = false;
+    std::string message; // Server error text, or why the batch got no answer
+};
+
+// ControlOp for a text command name; nullopt if the batch protocol has no such op
+std::optional<Binance::ControlOp> controlOpFromCommand(std::string_view command);
+
 class ZMQControlClient {
 public:
-    ZMQControlClient(const std::string& endpoint);
+    // Shares the caller's context (see Binance::ZMQTransport::context()) instead of owning one
+    ZMQControlClient(zmq::context_t& context, const std::string& endpoint);
     ~ZMQControlClient();
 
     // Sends a request and optionally waits for a reply
@@ -14,7 +45,55 @@ public:
     // Generic control request
     bool sendControlRequest(const std::string& requestStr, std::string& replyStr, FileLogger& logger, int timeoutMs = 500);
 
+    // Sends every operation in one ControlRequest and fills one outcome per operation,
+    // in the same order. False if the batch got no valid reply (every outcome then
+    // carries the reason); true even if individual operations failed.
+    bool sendControlBatch(const std::vector<ControlOperation>& operations, std::vector<ControlOutcome>& outcomes,
+                          FileLogger& logger, int timeoutMs = 500);
+
+    // Sends the batch and returns at once, for operations the caller must not block on
+    // (REST downloads, depth snapshots). Returns the batch id, 0 if it was not sent.
+    // With keepReply the reply is collected for pollBatchReply(); otherwise it is
+    // dropped quietly whenever it shows up.
+    uint64_t postControlBatch(const std::vector<ControlOperation>& operations, FileLogger& logger, bool keepReply = false);
+
+    // Never blocks: reads the replies that have arrived, then, if the one for posted
+    // batch `id` is among them, fills `outcomes` as sendControlBatch() would and returns true
+    bool pollBatchReply(uint64_t id, std::vector<ControlOutcome>& outcomes, FileLogger& logger);
+
+    // Stop waiting for posted batch `id`; a reply arriving later is dropped quietly
+    void forgetBatch(uint64_t id) { posted_.erase(id); }
+
 private:
-    zmq::context_t context_;
+    // A batch sent with postControlBatch() whose reply has not been taken yet
+    struct PostedBatch {
+        std::vector<ControlOutcome> outcomes; // Local failures already filled in
+        std::vector<size_t> sentIndex;        // Operation index of each item sent
+        bool keepReply = false;
+        bool replied = false;
+        std::string reply;
+    };
+    // Posted batches remembered at most; the oldest are forgotten beyond this
+    static constexpr size_t kMaxPostedBatches = 256;
+
+    // Encodes the operations that have a ControlOp; the others fail in `outcomes` right away.
+    // Returns the number of items encoded.
+    size_t buildBatch(uint64_t id, const std::vector<ControlOperation>& operations, flatbuffers::FlatBufferBuilder& builder,
+                      std::vector<ControlOutcome>& outcomes, std::vector<size_t>& sentIndex);
+    bool parseBatchReply(const std::string& reply, const std::vector<size_t>& sentIndex,
+                         std::vector<ControlOutcome>& outcomes, FileLogger& logger);
+
+    bool sendRequest(uint64_t id, const void* data, size_t size);
+
+    // Reads replies until the one tagged `id` arrives or the timeout expires
+    bool awaitReply(uint64_t id, std::string& replyStr, FileLogger& logger, int timeoutMs);
+    // Reads one whole multipart reply; false if it is not [empty][id][reply]
+    bool receiveReply(uint64_t& id, std::string& replyStr, std::string& rawId);
+    // Files the reply to a posted batch; false if `id` is not one
+    bool storePostedReply(uint64_t id, std::string& replyStr);
+
+    zmq::context_t& context_;
     zmq::socket_t socket_;
+    uint64_t nextId_ = 1;
+    std::map<uint64_t, PostedBatch> posted_; // Ordered by id, i.e. by age
 };
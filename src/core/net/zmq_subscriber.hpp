@@ -1,42 +1,59 @@
 #pragma once
 
-#include <zmq.hpp>
 #include <boost/lockfree/spsc_queue.hpp>
 #include <atomic>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
-#include <thread>  // Add this line
+#include "core/symbol_registry.hpp"
 
 
 namespace Binance {
 
+class ZMQTransport;
+
+// One received message: topic suffix resolved to a registry id + raw payload
+struct FeedMessage {
+    SymbolId symbolId = kInvalidSymbolId; // kInvalidSymbolId for topics without a known symbol
+    std::vector<uint8_t> payload;
+};
+
+// Typed message queue for one topic prefix on one endpoint.
+// Filled by the shared ZMQTransport poller thread, drained by a single consumer.
 class ZMQSubscriber {
 public:
-    explicit ZMQSubscriber(
-        size_t queue_capacity = 1024,
-        const std::string& endpoint = "tcp://127.0.0.1:5555"
-    );
-    
-    ~ZMQSubscriber();
-    
+    ZMQSubscriber(size_t queue_capacity, const std::string& topic_prefix);
+
     // Copy/move semantics
     ZMQSubscriber(const ZMQSubscriber&) = delete;
     ZMQSubscriber& operator=(const ZMQSubscriber&) = delete;
     ZMQSubscriber(ZMQSubscriber&&) = delete;
     ZMQSubscriber& operator=(ZMQSubscriber&&) = delete;
 
-    void start();
-    void stop() noexcept;
-    bool pop(std::pair<std::string, std::vector<uint8_t>>& data); // Updated to also return topic
+    bool pop(FeedMessage& data);
+
+    const std::string& topicPrefix() const { return topic_prefix_; }
+    uint64_t dropped() const { return dropped_.load(std::memory_order_relaxed); } // Messages lost to a full queue
+    size_t queued() const { return queue_->read_available(); } // Consumer thread only
+
+    // Whether ZMQTransport::addTopic() currently holds `symbol` on this per-symbol route.
+    // Any thread; lets a route that carries every symbol in one message (bookticker
+    // batches) keep only what the per-symbol route would have let through.
+    bool hasTopic(SymbolId symbol) const {
+        return symbol < active_topics_.size() && active_topics_[symbol].load(std::memory_order_relaxed) > 0;
+    }
 
 private:
-    void receive_loop();
-    std::unique_ptr<boost::lockfree::spsc_queue<std::pair<std::string, std::vector<uint8_t>>>> queue_; // Updated to hold topic and payload
-    std::string endpoint_;
-    zmq::context_t context_;
-    zmq::socket_t socket_;
-    std::atomic<bool> running_{false};
-    std::thread worker_thread_;
+    friend class ZMQTransport;
+    bool push(FeedMessage&& item); // Producer side (transport thread)
+
+    std::unique_ptr<boost::lockfree::spsc_queue<FeedMessage>> queue_;
+    std::string topic_prefix_;
+    bool per_symbol_topics_ = false;               // Socket filter follows addTopic/removeTopic
+    std::unordered_map<SymbolId, int> topic_refs_;     // Transport thread only
+    std::vector<std::atomic<int>> active_topics_;      // addTopic refs per SymbolId, readable anywhere
+    std::atomic<uint64_t> dropped_{0};
 };
-} // namespace Binance
\ No newline at end of file
+} // namespace Binance
@@ -0,0 +1,324 @@
+#include "zmq_transport.hpp"
+#include <algorithm>
+#include <iostream>
+#include <fmt/core.h>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace Binance {
+
+// Max messages taken from one socket per poll round, so a busy feed cannot starve the others
+static constexpr int kMaxBatchPerSocket = 256;
+// Ring records handled before the consumer is notified
+static constexpr int kMaxBatchPerRing = 1024;
+// Longest park in the ring loop; bounds how late topic changes and stop() are noticed
+static constexpr auto kRingWait = std::chrono::milliseconds(2);
+// Retry interval while the publisher has not created the ring yet
+static constexpr auto kRingAttachRetry = std::chrono::milliseconds(250);
+
+ZMQTransport::ZMQTransport(const SymbolRegistry& symbols, const ZMQTransportConfig& config)
+    : symbols_(symbols),
+      config_(config),
+      context_(config.ioThreads),
+      wakeAddress_(fmt::format("inproc://niktrade-transport-wake-{}", static_cast<const void*>(this))),
+      wakeRecv_(context_, ZMQ_PAIR),
+      wakeSend_(context_, ZMQ_PAIR)
+{
+#ifdef ZMQ_THREAD_AFFINITY_CPU_ADD
+    // Pin libzmq's I/O threads too; must be set before the first socket connects
+    for (int cpu : config_.cpuAffinity) {
+        context_.set(zmq::ctxopt::thread_affinity_cpu_add, cpu);
+    }
+#endif
+    wakeRecv_.bind(wakeAddress_);
+    wakeSend_.connect(wakeAddress_);
+}
+
+ZMQTransport::~ZMQTransport() {
+    stop();
+    for (auto& endpoint : endpoints_) endpoint->socket.close();
+    wakeSend_.close();
+    wakeRecv_.close();
+}
+
+ZMQSubscriber& ZMQTransport::subscribe(const std::string& endpoint, const std::string& topic_prefix,
+                                       size_t queue_capacity, bool per_symbol_topics) {
+    Endpoint* target = nullptr;
+    for (auto& existing : endpoints_) {
+        if (existing->address == endpoint) { target = existing.get(); break; }
+    }
+    if (!target) {
+        auto created = std::make_unique<Endpoint>();
+        created->address = endpoint;
+        if (!usingSharedMemory()) {
+            created->socket = zmq::socket_t(context_, ZMQ_SUB);
+            created->socket.set(zmq::sockopt::linger, 0);
+            created->socket.connect(endpoint);
+        }
+        target = created.get();
+        endpoints_.push_back(std::move(created));
+    }
+
+    // Filtered by libzmq; anything no route asked for never reaches the poller
+    // (on the ring, routeFor() applies the same filter)
+    auto route = std::make_unique<ZMQSubscriber>(queue_capacity, topic_prefix);
+    route->per_symbol_topics_ = per_symbol_topics;
+    if (per_symbol_topics) route->active_topics_ = std::vector<std::atomic<int>>(symbols_.size());
+    if (!per_symbol_topics && !usingSharedMemory()) target->socket.set(zmq::sockopt::subscribe, topic_prefix);
+    target->routes.push_back(std::move(route));
+    return *target->routes.back();
+}
+
+void ZMQTransport::addTopic(ZMQSubscriber& route, SymbolId symbol) {
+    if (!symbols_.contains(symbol)) return;
+    if (route.per_symbol_topics_) route.active_topics_[symbol].fetch_add(1, std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(commandMutex_);
+        pendingCommands_.push_back({&route, symbol, true});
+    }
+    commandsPending_.store(true, std::memory_order_release);
+    wake();
+}
+
+void ZMQTransport::removeTopic(ZMQSubscriber& route, SymbolId symbol) {
+    if (!symbols_.contains(symbol)) return;
+    if (route.per_symbol_topics_) {
+        std::atomic<int>& refs = route.active_topics_[symbol];
+        int current = refs.load(std::memory_order_relaxed);
+        while (current > 0 && !refs.compare_exchange_weak(current, current - 1, std::memory_order_relaxed)) {}
+    }
+    {
+        std::lock_guard<std::mutex> lock(commandMutex_);
+        pendingCommands_.push_back({&route, symbol, false});
+    }
+    commandsPending_.store(true, std::memory_order_release);
+    wake();
+}
+
+void ZMQTransport::wake() {
+    std::lock_guard<std::mutex> lock(wakeMutex_);
+    try {
+        wakeSend_.send(zmq::message_t(), zmq::send_flags::dontwait);
+    } catch (const zmq::error_t&) {}
+}
+
+// Poller thread: apply queued subscribe/unsubscribe requests to the owning SUB sockets
+void ZMQTransport::applyTopicCommands() {
+    std::vector<TopicCommand> commands;
+    {
+        std::lock_guard<std::mutex> lock(commandMutex_);
+        commands.swap(pendingCommands_);
+    }
+
+    for (const TopicCommand& cmd : commands) {
+        ZMQSubscriber& route = *cmd.route;
+        if (!route.per_symbol_topics_) continue;
+
+        zmq::socket_t* socket = nullptr;
+        for (auto& endpoint : endpoints_) {
+            for (auto& r : endpoint->routes) {
+                if (r.get() == &route) socket = &endpoint->socket;
+            }
+        }
+        if (!socket) continue;
+
+        // Ring routes have no socket; topic_refs_ alone is the filter
+        bool hasSocket = socket->handle() != nullptr;
+        std::string topic = route.topic_prefix_ + symbols_.name(cmd.symbol);
+        int& refs = route.topic_refs_[cmd.symbol];
+        if (cmd.subscribe) {
+            if (refs++ == 0 && hasSocket) socket->set(zmq::sockopt::subscribe, topic);
+        } else if (refs > 0) {
+            if (--refs == 0) {
+                if (hasSocket) socket->set(zmq::sockopt::unsubscribe, topic);
+                route.topic_refs_.erase(cmd.symbol);
+            }
+        }
+    }
+}
+
+void ZMQTransport::start() {
+    if (!running_.exchange(true)) {
+        if (usingSharedMemory()) poller_thread_ = std::thread(&ZMQTransport::ring_loop, this);
+        else poller_thread_ = std::thread(&ZMQTransport::poll_loop, this);
+    }
+}
+
+void ZMQTransport::stop() noexcept {
+    if (running_.exchange(false)) wake();
+    if (poller_thread_.joinable()) poller_thread_.join();
+    notifyData(); // Release anyone still waiting on data
+}
+
+bool ZMQTransport::waitForData(std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(dataMutex_);
+    bool ready = dataCv_.wait_for(lock, timeout, [this] { return dataReady_; });
+    dataReady_ = false;
+    return ready;
+}
+
+void ZMQTransport::notifyData() {
+    {
+        std::lock_guard<std::mutex> lock(dataMutex_);
+        dataReady_ = true;
+    }
+    dataCv_.notify_all();
+}
+
+void ZMQTransport::applyAffinity() {
+    if (config_.cpuAffinity.empty()) return;
+#ifdef _WIN32
+    DWORD_PTR mask = 0;
+    for (int cpu : config_.cpuAffinity) mask |= (DWORD_PTR(1) << cpu);
+    SetThreadAffinityMask(GetCurrentThread(), mask);
+#elif defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int cpu : config_.cpuAffinity) CPU_SET(cpu, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    // macOS has no hard thread affinity; leave scheduling to the OS
+#endif
+}
+
+void ZMQTransport::poll_loop() {
+    applyAffinity();
+
+    // Slot 0 is the wake socket, slot i+1 is endpoints_[i]
+    std::vector<zmq::pollitem_t> items;
+    items.reserve(endpoints_.size() + 1);
+    items.push_back({wakeRecv_.handle(), 0, ZMQ_POLLIN, 0});
+    for (auto& endpoint : endpoints_) {
+        items.push_back({endpoint->socket.handle(), 0, ZMQ_POLLIN, 0});
+    }
+
+    while (running_.load(std::memory_order_acquire)) {
+        try {
+            // No timeout: the thread only wakes for traffic or for stop()
+            zmq::poll(items.data(), items.size(), std::chrono::milliseconds(-1));
+            if (items[0].revents & ZMQ_POLLIN) {
+                zmq::message_t signal;
+                while (wakeRecv_.recv(signal, zmq::recv_flags::dontwait)) {}
+                if (!running_.load(std::memory_order_acquire)) break;
+                applyTopicCommands();
+            }
+
+            bool received = false;
+            for (size_t i = 0; i < endpoints_.size(); ++i) {
+                if (items[i + 1].revents & ZMQ_POLLIN) received |= drain(*endpoints_[i]);
+            }
+            if (received) notifyData();
+        } catch (const zmq::error_t& e) {
+            // Ignore ETERM; it means context is terminated
+            if (e.num() != ETERM) {
+                std::cerr << "ZMQ error: " << e.what() << "\n";
+            }
+            break; // Exit loop on error
+        }
+    }
+}
+
+// Read up to kMaxBatchPerSocket queued multipart messages without blocking
+bool ZMQTransport::drain(Endpoint& endpoint) {
+    bool received = false;
+    for (int n = 0; n < kMaxBatchPerSocket; ++n) {
+        // Receive topic frame first
+        zmq::message_t topic_msg;
+        if (!endpoint.socket.recv(topic_msg, zmq::recv_flags::dontwait)) break;
+        if (!topic_msg.more()) continue; // Malformed: no payload frame
+
+        // Receive payload frame second
+        zmq::message_t payload_msg;
+        if (!endpoint.socket.recv(payload_msg, zmq::recv_flags::none)) break;
+
+        std::string_view topic(static_cast<const char*>(topic_msg.data()), topic_msg.size());
+
+        SymbolId symbolId;
+        ZMQSubscriber* route = routeFor(endpoint, topic, symbolId);
+        if (!route) continue;
+
+        const auto* data = static_cast<const uint8_t*>(payload_msg.data());
+        FeedMessage item;
+        item.symbolId = symbolId;
+        item.payload.assign(data, data + payload_msg.size());
+        route->push(std::move(item));
+        received = true;
+    }
+    return received;
+}
+
+// First route whose prefix matches; per-symbol routes also need an active topic
+ZMQSubscriber* ZMQTransport::routeFor(Endpoint& endpoint, std::string_view topic, SymbolId& symbolId) {
+    for (auto& route : endpoint.routes) {
+        const std::string& prefix = route->topicPrefix();
+        if (topic.substr(0, prefix.size()) != prefix) continue;
+
+        symbolId = symbols_.find(topic.substr(prefix.size()));
+        if (route->per_symbol_topics_ && !route->topic_refs_.count(symbolId)) return nullptr;
+        return route.get();
+    }
+    return nullptr;
+}
+
+// ------------------ Shared-memory ring ------------------
+// Same job as poll_loop for the ring: one reader serves every route, whatever port the
+// topic used to arrive on. The ring may not exist yet when the app starts (the
+// publisher creates it), so attaching is retried.
+void ZMQTransport::ring_loop() {
+    applyAffinity();
+
+    ShmRingReader ring;
+    auto nextAttach = std::chrono::steady_clock::now();
+    while (running_.load(std::memory_order_acquire)) {
+        if (commandsPending_.exchange(false, std::memory_order_acq_rel)) applyTopicCommands();
+
+        if (!ring.attached()) {
+            auto now = std::chrono::steady_clock::now();
+            if (now < nextAttach || !ring.open(config_.shmRingPath)) {
+                nextAttach = std::max(nextAttach, now + kRingAttachRetry);
+                std::this_thread::sleep_for(kRingWait);
+                continue;
+            }
+        }
+
+        if (drainRing(ring)) {
+            notifyData();
+            continue;
+        }
+        ring.waitForWrite(kRingWait);
+    }
+}
+
+// The payload is copied out of the mapping before consume() confirms it was not overwritten
+bool ZMQTransport::drainRing(ShmRingReader& ring) {
+    bool received = false;
+    ShmRecord record;
+    for (int n = 0; n < kMaxBatchPerRing && ring.peek(record); ++n) {
+        SymbolId symbolId = kInvalidSymbolId;
+        ZMQSubscriber* route = nullptr;
+        for (auto& endpoint : endpoints_) {
+            if ((route = routeFor(*endpoint, record.topic, symbolId))) break;
+        }
+
+        FeedMessage item;
+        if (route) {
+            item.symbolId = symbolId;
+            item.payload.assign(record.payload, record.payload + record.payloadSize);
+        }
+        if (!ring.consume(record)) break;
+        if (!route) continue;
+
+        route->push(std::move(item));
+        received = true;
+    }
+    ringOverruns_.store(ring.overruns(), std::memory_order_relaxed);
+    return received;
+}
+
+} // namespace Binance
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <zmq.hpp>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "core/net/zmq_subscriber.hpp"
+#include "core/net/shm_ring.hpp"
+#include "core/symbol_registry.hpp"
+
+namespace Binance {
+
+struct ZMQTransportConfig {
+    int ioThreads = 1;            // libzmq I/O threads for the shared context
+    std::vector<int> cpuAffinity; // CPUs for the poller + I/O threads (empty = OS default)
+    std::string shmRingPath;      // Non-empty: read every route from this shared-memory ring
+                                  // (see shm_ring.hpp) instead of the SUB sockets
+};
+
+// Shared transport layer: one zmq context and one poller thread multiplexing every
+// SUB socket, dispatching each message by topic prefix into its ZMQSubscriber queue.
+// The topic suffix after the prefix (the symbol) is resolved to its SymbolId on arrival.
+//
+// With ZMQTransportConfig::shmRingPath set, the same routes are fed from a shared-memory
+// ring instead: the poller reads records in place and no SUB sockets are opened.
+class ZMQTransport {
+public:
+    explicit ZMQTransport(const SymbolRegistry& symbols, const ZMQTransportConfig& config = {});
+    ~ZMQTransport();
+
+    ZMQTransport(const ZMQTransport&) = delete;
+    ZMQTransport& operator=(const ZMQTransport&) = delete;
+
+    // Register a typed queue for `topic_prefix` on `endpoint` (one SUB socket per endpoint).
+    // With per_symbol_topics the socket receives nothing until addTopic() asks for a symbol,
+    // so libzmq filters unwanted symbols on the publisher side. Must be called before start().
+    ZMQSubscriber& subscribe(const std::string& endpoint, const std::string& topic_prefix,
+                             size_t queue_capacity, bool per_symbol_topics = false);
+
+    // Runtime subscription changes for per-symbol routes (reference counted, any thread).
+    // Applied on the poller thread, which owns the sockets.
+    void addTopic(ZMQSubscriber& route, SymbolId symbol);
+    void removeTopic(ZMQSubscriber& route, SymbolId symbol);
+
+    const SymbolRegistry& symbols() const { return symbols_; }
+
+    void start();
+    void stop() noexcept;
+
+    // Shared context for other sockets (e.g. the control client)
+    zmq::context_t& context() { return context_; }
+
+    // Blocks until the poller has queued new messages or the timeout expires.
+    // Lets consumers sleep instead of spinning on empty queues.
+    bool waitForData(std::chrono::milliseconds timeout);
+
+    bool usingSharedMemory() const { return !config_.shmRingPath.empty(); }
+    uint64_t ringOverruns() const { return ringOverruns_.load(std::memory_order_relaxed); }
+
+    // Wakes waitForData(); also used by feeds that bypass the SUB sockets
+    void notifyData();
+
+private:
+    struct Endpoint {
+        std::string address;
+        zmq::socket_t socket;
+        std::vector<std::unique_ptr<ZMQSubscriber>> routes;
+    };
+
+    struct TopicCommand {
+        ZMQSubscriber* route;
+        SymbolId symbol;
+        bool subscribe;
+    };
+
+    void poll_loop();
+    void ring_loop();
+    bool drain(Endpoint& endpoint);
+    bool drainRing(ShmRingReader& ring);
+    ZMQSubscriber* routeFor(Endpoint& endpoint, std::string_view topic, SymbolId& symbolId);
+    void wake();
+    void applyTopicCommands();
+    void applyAffinity();
+
+    const SymbolRegistry& symbols_;
+    ZMQTransportConfig config_;
+    zmq::context_t context_;
+    std::string wakeAddress_;
+    zmq::socket_t wakeRecv_;     // Polled alongside the SUB sockets
+    zmq::socket_t wakeSend_;     // Interrupts the blocking poll (stop / topic changes)
+    std::mutex wakeMutex_;       // wakeSend_ may be used from several threads
+    std::vector<std::unique_ptr<Endpoint>> endpoints_;
+
+    std::mutex commandMutex_;
+    std::vector<TopicCommand> pendingCommands_;
+    std::atomic<bool> commandsPending_{false}; // Polled by the ring loop, which has no wake socket
+    std::atomic<uint64_t> ringOverruns_{0};
+
+    std::mutex dataMutex_;
+    std::condition_variable dataCv_;
+    bool dataReady_ = false;
+
+    std::atomic<bool> running_{false};
+    std::thread poller_thread_;
+};
+
+} // namespace Binance
@@ -0,0 +1,72 @@
+#include "order_book.hpp"
+#include <algorithm>
+
+namespace {
+
+// Sets one level on a side sorted worst -> best. `worse(a, b)` is true when price a
+// ranks below price b on that side. Never grows the vector past its reserved capacity.
+template <typename Worse>
+void setLevel(std::vector<BookLevel>& side, size_t maxLevels, double price, double quantity, Worse worse) {
+    auto it = std::lower_bound(side.begin(), side.end(), price,
+                               [&](const BookLevel& level, double p) { return worse(level.price, p); });
+    bool exists = it != side.end() && it->price == price;
+
+    if (quantity == 0.0) {
+        if (exists) side.erase(it);
+        return;
+    }
+    if (exists) {
+        it->quantity = quantity;
+        return;
+    }
+
+    if (side.size() >= maxLevels) {
+        // Full: a level worse than everything we hold is not worth keeping,
+        // otherwise make room by dropping the current worst level
+        if (it == side.begin()) return;
+        auto index = (it - side.begin()) - 1;
+        side.erase(side.begin());
+        it = side.begin() + index;
+    }
+    side.insert(it, BookLevel{price, quantity});
+}
+
+} // namespace
+
+OrderBook::OrderBook(size_t maxLevelsPerSide)
+    : maxLevels_(maxLevelsPerSide)
+{
+    bids_.reserve(maxLevels_);
+    asks_.reserve(maxLevels_);
+}
+
+void OrderBook::beginSnapshot(uint64_t lastUpdateId) {
+    bids_.clear();
+    asks_.clear();
+    lastUpdateId_ = lastUpdateId;
+    state_ = State::Synced;
+}
+
+OrderBook::UpdateCheck OrderBook::beginUpdate(uint64_t firstUpdateId, uint64_t finalUpdateId) {
+    if (state_ != State::Synced) return UpdateCheck::NeedsSnapshot;
+    if (finalUpdateId <= lastUpdateId_) return UpdateCheck::Stale;
+    if (firstUpdateId > lastUpdateId_ + 1) {
+        state_ = State::OutOfSync;
+        return UpdateCheck::Gap;
+    }
+    lastUpdateId_ = finalUpdateId;
+    return UpdateCheck::Apply;
+}
+
+void OrderBook::setBid(double price, double quantity) {
+    setLevel(bids_, maxLevels_, price, quantity, [](double a, double b) { return a < b; });
+}
+
+void OrderBook::setAsk(double price, double quantity) {
+    setLevel(asks_, maxLevels_, price, quantity, [](double a, double b) { return a > b; });
+}
+
+void OrderBook::topLevels(size_t levels, std::vector<BookLevel>& bids, std::vector<BookLevel>& asks) const {
+    bids.assign(bids_.rbegin(), bids_.rbegin() + std::min(levels, bids_.size()));
+    asks.assign(asks_.rbegin(), asks_.rbegin() + std::min(levels, asks_.size()));
+}
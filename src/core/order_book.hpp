@@ -0,0 +1,72 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// One aggregated price level
+struct BookLevel {
+    double price = 0.0;
+    double quantity = 0.0;
+};
+
+// Local L2 order book for one symbol, kept in sync from a depth snapshot plus diff updates.
+//
+// Each side is a flat array sorted worst -> best, so the best price sits at the back.
+// Almost all diffs touch the top of the book, which makes inserts/erases shift only a
+// few trailing levels. Capacity is reserved up front: applying updates never allocates.
+class OrderBook {
+public:
+    enum class State {
+        AwaitingSnapshot, // No snapshot yet; diffs must be buffered by the caller
+        Synced,           // Snapshot applied and every diff since has been contiguous
+        OutOfSync         // Update ids skipped; needs a fresh snapshot
+    };
+
+    enum class UpdateCheck {
+        Apply,         // Diff continues the book; feed its levels via setBid/setAsk
+        Stale,         // Already covered by the snapshot/previous diffs; drop it
+        NeedsSnapshot, // Book is not synced yet; keep the diff until a snapshot arrives
+        Gap            // Update ids skipped; book is now OutOfSync
+    };
+
+    explicit OrderBook(size_t maxLevelsPerSide = 5000);
+
+    // Start a new book image at `lastUpdateId`; both sides are cleared and then
+    // filled through setBid/setAsk
+    void beginSnapshot(uint64_t lastUpdateId);
+
+    // Binance diff rules: drop events with u <= lastUpdateId; the next event must
+    // satisfy U <= lastUpdateId + 1 <= u, otherwise updates were lost
+    UpdateCheck beginUpdate(uint64_t firstUpdateId, uint64_t finalUpdateId);
+
+    // Set a level to an absolute quantity; quantity 0 removes it
+    void setBid(double price, double quantity);
+    void setAsk(double price, double quantity);
+
+    // Copy up to `levels` levels per side, best first (clears both outputs)
+    void topLevels(size_t levels, std::vector<BookLevel>& bids, std::vector<BookLevel>& asks) const;
+
+    State state() const { return state_; }
+    uint64_t lastUpdateId() const { return lastUpdateId_; }
+    size_t bidDepth() const { return bids_.size(); }
+    size_t askDepth() const { return asks_.size(); }
+    size_t maxLevelsPerSide() const { return maxLevels_; }
+
+private:
+    std::vector<BookLevel> bids_; // Ascending price, best bid at back()
+    std::vector<BookLevel> asks_; // Descending price, best ask at back()
+    size_t maxLevels_;
+    uint64_t lastUpdateId_ = 0;
+    State state_ = State::AwaitingSnapshot;
+};
+
+// Levels per side copied out of a book for rendering
+inline constexpr size_t kBookViewLevels = 20;
+
+// Render-side copy of the top of a book, best levels first
+struct OrderBookView {
+    std::vector<BookLevel> bids;
+    std::vector<BookLevel> asks;
+    uint64_t lastUpdateId = 0;
+    OrderBook::State state = OrderBook::State::AwaitingSnapshot;
+};
@@ -0,0 +1,574 @@
+#include "series_archive.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr uint32_t kArchiveMagic = 0x41544B4E; // "NKTA"
+constexpr uint16_t kArchiveVersion = 1;
+constexpr size_t kFileHeaderSize = 16;
+constexpr size_t kMaxTimeColumns = 2;
+
+// Either kind's columns as the uniform list the block codec works on
+struct ColumnRefs {
+    std::array<std::vector<uint64_t>*, kMaxTimeColumns> times{};
+    std::array<std::vector<double>*, kArchiveMaxValues> values{};
+    size_t timeCount = 0;
+    size_t valueCount = 0;
+};
+
+ColumnRefs columnRefs(CandleColumns& c) {
+    return {{&c.openTime, &c.closeTime}, {&c.open, &c.high, &c.low, &c.close, &c.volume}, 2, 5};
+}
+
+ColumnRefs columnRefs(QuoteColumns& q) {
+    return {{&q.timeNs}, {&q.bidPrice, &q.bidQuantity, &q.askPrice, &q.askQuantity}, 1, 4};
+}
+
+size_t valueCountOf(ArchiveKind kind) {
+    return kind == ArchiveKind::Candles ? 5 : 4;
+}
+
+size_t footerSize(ArchiveKind kind) {
+    return 24 + 16 * valueCountOf(kind);
+}
+
+template <typename T>
+void put(std::vector<uint8_t>& out, T value) {
+    size_t at = out.size();
+    out.resize(at + sizeof(T));
+    std::memcpy(out.data() + at, &value, sizeof(T));
+}
+
+template <typename T>
+T get(const uint8_t* p) {
+    T value;
+    std::memcpy(&value, p, sizeof(T));
+    return value;
+}
+
+void putVarint(std::vector<uint8_t>& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<uint8_t>(value) | 0x80);
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+bool getVarint(const uint8_t*& p, const uint8_t* end, uint64_t& value) {
+    value = 0;
+    for (unsigned shift = 0; p < end && shift < 64; shift += 7) {
+        uint8_t byte = *p++;
+        value |= uint64_t(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) return true;
+    }
+    return false;
+}
+
+uint64_t zigzag(int64_t v) { return (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63); }
+int64_t unzigzag(uint64_t v) { return static_cast<int64_t>(v >> 1) ^ -static_cast<int64_t>(v & 1); }
+
+// MSB-first bit packing
+class BitWriter {
+public:
+    explicit BitWriter(std::vector<uint8_t>& out) : out_(out) {}
+
+    void write(uint64_t value, unsigned bits) {
+        if (bits > 32) {
+            write(value >> 32, bits - 32);
+            bits = 32;
+        }
+        acc_ = (acc_ << bits) | (value & ((uint64_t(1) << bits) - 1));
+        count_ += bits;
+        while (count_ >= 8) {
+            count_ -= 8;
+            out_.push_back(static_cast<uint8_t>(acc_ >> count_));
+        }
+    }
+
+    void finish() {
+        if (count_ > 0) out_.push_back(static_cast<uint8_t>(acc_ << (8 - count_)));
+        count_ = 0;
+    }
+
+private:
+    std::vector<uint8_t>& out_;
+    uint64_t acc_ = 0;
+    unsigned count_ = 0;
+};
+
+uint64_t loadBigEndian(const uint8_t* p) {
+    uint64_t value = 0;
+    for (int i = 0; i < 8; ++i) value = (value << 8) | p[i];
+    return value;
+}
+
+// MSB-first bit unpacking from a left-aligned 64-bit window, refilled a byte at a time
+class BitReader {
+public:
+    BitReader(const uint8_t* data, size_t size) : p_(data), end_(data + size), left_(uint64_t(size) * 8) {}
+
+    uint64_t read(unsigned bits) {
+        if (bits > 32) {
+            uint64_t high = read(bits - 32);
+            return (high << 32) | read(32);
+        }
+        if (count_ < bits) refill();
+        uint64_t value = acc_ >> (64 - bits);
+        acc_ <<= bits;
+        count_ -= bits;
+        consume(bits);
+        return value;
+    }
+
+    // Leading one bits, at most `max` (< 8), and the 0 that ends them if under `max`
+    unsigned ones(unsigned max) {
+        if (count_ < 8) refill();
+        unsigned n = std::min(static_cast<unsigned>(std::countl_one(acc_)), max);
+        unsigned used = n < max ? n + 1 : n;
+        acc_ <<= used;
+        count_ -= used;
+        consume(used);
+        return n;
+    }
+
+    // True once more bits were read than the stream holds (the excess reads as zeros)
+    bool overrun() const { return overrun_; }
+
+private:
+    void refill() {
+        if (end_ - p_ >= 8) {
+            // Whole bytes that fit go in; the bits of the next byte that also land in the
+            // window are the same ones the next refill ORs in, so they do no harm
+            acc_ |= loadBigEndian(p_) >> count_;
+            unsigned bytes = (63 - count_) >> 3;
+            p_ += bytes;
+            count_ += bytes * 8;
+            return;
+        }
+        while (count_ <= 56) {
+            uint64_t byte = p_ < end_ ? *p_++ : 0;
+            acc_ |= byte << (56 - count_);
+            count_ += 8;
+        }
+    }
+
+    void consume(unsigned bits) {
+        if (bits > left_) overrun_ = true;
+        left_ -= std::min<uint64_t>(bits, left_);
+    }
+
+    const uint8_t* p_;
+    const uint8_t* end_;
+    uint64_t left_; // Stream bits not read yet
+    uint64_t acc_ = 0;
+    unsigned count_ = 0;
+    bool overrun_ = false;
+};
+
+// ------------------ Time columns: delta-of-delta ------------------
+// First value raw, then the zigzagged change of the delta in the smallest bucket:
+// 0 | 10+7 | 110+9 | 1110+12 | 11110+32 | 11111+64 bits
+constexpr unsigned kDodBits[] = {7, 9, 12, 32, 64};
+
+void encodeTimes(const uint64_t* v, size_t n, std::vector<uint8_t>& out) {
+    BitWriter w(out);
+    w.write(v[0], 64);
+    int64_t prevDelta = 0;
+    for (size_t i = 1; i < n; ++i) {
+        int64_t delta = static_cast<int64_t>(v[i] - v[i - 1]);
+        uint64_t dod = zigzag(delta - prevDelta);
+        prevDelta = delta;
+        if (dod == 0) {
+            w.write(0, 1);
+            continue;
+        }
+        unsigned bucket = 0;
+        while (bucket < 4 && dod >> kDodBits[bucket]) ++bucket;
+        // bucket+1 one bits, then a 0 that the last bucket does without
+        if (bucket < 4) w.write(((uint64_t(1) << (bucket + 1)) - 1) << 1, bucket + 2);
+        else w.write(0b11111, 5);
+        w.write(dod, kDodBits[bucket]);
+    }
+    w.finish();
+}
+
+bool decodeTimes(const uint8_t* data, size_t size, size_t n, uint64_t* out) {
+    BitReader r(data, size);
+    uint64_t value = r.read(64);
+    out[0] = value;
+    int64_t delta = 0;
+    for (size_t i = 1; i < n; ++i) {
+        unsigned ones = r.ones(5);
+        if (ones > 0) delta += unzigzag(r.read(kDodBits[ones - 1]));
+        value += static_cast<uint64_t>(delta);
+        out[i] = value;
+    }
+    return !r.overrun();
+}
+
+// ------------------ Value columns: Gorilla XOR ------------------
+// First value raw, then the XOR with the previous value: 0 if equal; 10 + the bits
+// inside the previous leading/trailing-zero window if they fit it; else 11 + 5 bits
+// leading zeros + 6 bits length - 1 + the meaningful bits
+void encodeValues(const double* v, size_t n, std::vector<uint8_t>& out) {
+    BitWriter w(out);
+    uint64_t prev = std::bit_cast<uint64_t>(v[0]);
+    w.write(prev, 64);
+    bool haveWindow = false;
+    unsigned prevLead = 0, prevTrail = 0;
+    for (size_t i = 1; i < n; ++i) {
+        uint64_t cur = std::bit_cast<uint64_t>(v[i]);
+        uint64_t x = cur ^ prev;
+        prev = cur;
+        if (x == 0) {
+            w.write(0, 1);
+            continue;
+        }
+        unsigned lead = std::min(static_cast<unsigned>(std::countl_zero(x)), 31u);
+        unsigned trail = static_cast<unsigned>(std::countr_zero(x));
+        if (haveWindow && lead >= prevLead && trail >= prevTrail) {
+            w.write(0b10, 2);
+            w.write(x >> prevTrail, 64 - prevLead - prevTrail);
+        } else {
+            unsigned meaningful = 64 - lead - trail;
+            w.write(0b11, 2);
+            w.write(lead, 5);
+            w.write(meaningful - 1, 6);
+            w.write(x >> trail, meaningful);
+            haveWindow = true;
+            prevLead = lead;
+            prevTrail = trail;
+        }
+    }
+    w.finish();
+}
+
+bool decodeValues(const uint8_t* data, size_t size, size_t n, double* out) {
+    BitReader r(data, size);
+    uint64_t value = r.read(64);
+    out[0] = std::bit_cast<double>(value);
+    unsigned lead = 0, trail = 0;
+    for (size_t i = 1; i < n; ++i) {
+        if (r.read(1)) {
+            if (r.read(1)) {
+                lead = static_cast<unsigned>(r.read(5));
+                unsigned meaningful = static_cast<unsigned>(r.read(6)) + 1;
+                if (lead + meaningful > 64) return false;
+                trail = 64 - lead - meaningful;
+            }
+            value ^= r.read(64 - lead - trail) << trail;
+        }
+        out[i] = std::bit_cast<double>(value);
+    }
+    return !r.overrun();
+}
+
+// ------------------ Blocks ------------------
+// Decode one block's payload onto the end of every column
+bool decodeBlock(const uint8_t* p, size_t size, size_t rows, const ColumnRefs& cols) {
+    const uint8_t* end = p + size;
+    uint64_t length = 0;
+    for (size_t c = 0; c < cols.timeCount; ++c) {
+        std::vector<uint64_t>& column = *cols.times[c];
+        if (!getVarint(p, end, length) || length > static_cast<uint64_t>(end - p)) return false;
+        column.resize(column.size() + rows);
+        if (!decodeTimes(p, length, rows, column.data() + column.size() - rows)) return false;
+        p += length;
+    }
+    for (size_t c = 0; c < cols.valueCount; ++c) {
+        std::vector<double>& column = *cols.values[c];
+        if (!getVarint(p, end, length) || length > static_cast<uint64_t>(end - p)) return false;
+        column.resize(column.size() + rows);
+        if (!decodeValues(p, length, rows, column.data() + column.size() - rows)) return false;
+        p += length;
+    }
+    return true;
+}
+
+void truncateColumns(const ColumnRefs& cols, size_t rows) {
+    for (size_t c = 0; c < cols.timeCount; ++c) cols.times[c]->resize(std::min(cols.times[c]->size(), rows));
+    for (size_t c = 0; c < cols.valueCount; ++c) cols.values[c]->resize(std::min(cols.values[c]->size(), rows));
+}
+
+// Drop rows [first, last) of every column
+void eraseRows(const ColumnRefs& cols, size_t first, size_t last) {
+    for (size_t c = 0; c < cols.timeCount; ++c) cols.times[c]->erase(cols.times[c]->begin() + first, cols.times[c]->begin() + last);
+    for (size_t c = 0; c < cols.valueCount; ++c) cols.values[c]->erase(cols.values[c]->begin() + first, cols.values[c]->begin() + last);
+}
+
+bool readHeader(const uint8_t* p, ArchiveKind& kind) {
+    if (get<uint32_t>(p) != kArchiveMagic || get<uint16_t>(p + 4) != kArchiveVersion) return false;
+    uint8_t k = p[6];
+    if (k != static_cast<uint8_t>(ArchiveKind::Candles) && k != static_cast<uint8_t>(ArchiveKind::Quotes)) return false;
+    kind = static_cast<ArchiveKind>(k);
+    return true;
+}
+
+// Footer fields after the payload; false if the block cannot be valid
+bool readFooter(const uint8_t* p, ArchiveKind kind, ArchiveBlock& block) {
+    block.rows = get<uint32_t>(p);
+    block.firstTime = get<uint64_t>(p + 8);
+    block.lastTime = get<uint64_t>(p + 16);
+    size_t values = valueCountOf(kind);
+    for (size_t c = 0; c < values; ++c) {
+        block.min[c] = get<double>(p + 24 + 8 * c);
+        block.max[c] = get<double>(p + 24 + 8 * (values + c));
+    }
+    return block.rows > 0 && block.rows <= kArchiveBlockRows && block.firstTime <= block.lastTime;
+}
+
+// Append the rows of one block that fall in `range`; false (and nothing appended) if it is corrupt
+bool decodeBlockRows(const std::vector<uint8_t>& data, const ArchiveBlock& block, TimeRange range, const ColumnRefs& cols) {
+    std::vector<uint64_t>& time = *cols.times[0];
+    size_t base = time.size();
+    if (!decodeBlock(data.data() + block.payloadOffset, block.payloadSize, block.rows, cols)) {
+        truncateColumns(cols, base);
+        return false;
+    }
+    // Only a block straddling a range end has rows to drop
+    if (block.firstTime < range.from || block.lastTime > range.to) {
+        size_t last = static_cast<size_t>(std::upper_bound(time.begin() + base, time.end(), range.to) - time.begin());
+        truncateColumns(cols, last);
+        size_t first = static_cast<size_t>(std::lower_bound(time.begin() + base, time.end(), range.from) - time.begin());
+        eraseRows(cols, base, first);
+    }
+    return true;
+}
+
+template <typename Columns>
+size_t decodeRange(const std::vector<uint8_t>& data, const std::vector<ArchiveBlock>& blocks, TimeRange range, Columns& out) {
+    ColumnRefs cols = columnRefs(out);
+    size_t start = out.size();
+    for (const ArchiveBlock& block : blocks) {
+        if (block.lastTime < range.from) continue;
+        if (block.firstTime > range.to) break; // Rows (and so blocks) are in time order
+        if (!decodeBlockRows(data, block, range, cols)) break;
+    }
+    return out.size() - start;
+}
+
+} // namespace
+
+// ------------------ Columns ------------------
+void CandleColumns::clear() {
+    openTime.clear(); closeTime.clear();
+    open.clear(); high.clear(); low.clear(); close.clear(); volume.clear();
+}
+
+void CandleColumns::reserve(size_t rows) {
+    openTime.reserve(rows); closeTime.reserve(rows);
+    open.reserve(rows); high.reserve(rows); low.reserve(rows); close.reserve(rows); volume.reserve(rows);
+}
+
+void CandleColumns::push_back(const KlineData& candle) {
+    openTime.push_back(candle.open_time);
+    closeTime.push_back(candle.close_time);
+    open.push_back(candle.open);
+    high.push_back(candle.high);
+    low.push_back(candle.low);
+    close.push_back(candle.close);
+    volume.push_back(candle.volume);
+}
+
+KlineData CandleColumns::row(size_t i) const {
+    return KlineData{openTime[i], open[i], high[i], low[i], close[i], volume[i], closeTime[i]};
+}
+
+void QuoteColumns::clear() {
+    timeNs.clear();
+    bidPrice.clear(); bidQuantity.clear(); askPrice.clear(); askQuantity.clear();
+}
+
+void QuoteColumns::reserve(size_t rows) {
+    timeNs.reserve(rows);
+    bidPrice.reserve(rows); bidQuantity.reserve(rows); askPrice.reserve(rows); askQuantity.reserve(rows);
+}
+
+void QuoteColumns::push_back(uint64_t receiveTimeNs, const BBO& quote) {
+    timeNs.push_back(receiveTimeNs);
+    bidPrice.push_back(quote.bid_price);
+    bidQuantity.push_back(quote.bid_quantity);
+    askPrice.push_back(quote.ask_price);
+    askQuantity.push_back(quote.ask_quantity);
+}
+
+// ------------------ SeriesArchiveWriter ------------------
+SeriesArchiveWriter::SeriesArchiveWriter(ArchiveKind kind)
+    : kind_(kind)
+{
+    if (kind_ == ArchiveKind::Candles) candles_.reserve(kArchiveBlockRows);
+    else quotes_.reserve(kArchiveBlockRows);
+}
+
+SeriesArchiveWriter::~SeriesArchiveWriter() {
+    close();
+}
+
+bool SeriesArchiveWriter::open(const fs::path& path) {
+    close();
+    std::error_code ec;
+    uint64_t size = fs::exists(path, ec) ? fs::file_size(path, ec) : 0;
+    if (ec) return false;
+
+    uint64_t validEnd = 0;
+    if (size >= kFileHeaderSize) {
+        // Find where the intact blocks end, so new blocks don't land behind a torn one
+        std::ifstream in(path, std::ios::binary);
+        uint8_t header[kFileHeaderSize];
+        ArchiveKind kind;
+        if (!in.read(reinterpret_cast<char*>(header), sizeof(header)) || !readHeader(header, kind) || kind != kind_) return false;
+
+        std::vector<uint8_t> footer(footerSize(kind_));
+        validEnd = kFileHeaderSize;
+        uint32_t payloadSize = 0;
+        while (in.seekg(static_cast<std::streamoff>(validEnd)) && in.read(reinterpret_cast<char*>(&payloadSize), sizeof(payloadSize))) {
+            uint64_t blockEnd = validEnd + 4 + payloadSize + footer.size();
+            ArchiveBlock block;
+            if (blockEnd > size || !in.seekg(static_cast<std::streamoff>(validEnd + 4 + payloadSize)) ||
+                !in.read(reinterpret_cast<char*>(footer.data()), static_cast<std::streamsize>(footer.size())) ||
+                !readFooter(footer.data(), kind_, block)) {
+                break;
+            }
+            validEnd = blockEnd;
+        }
+        in.close();
+        if (validEnd != size) fs::resize_file(path, validEnd, ec);
+    }
+
+    out_.open(path, std::ios::binary | (validEnd > 0 ? std::ios::app : std::ios::trunc));
+    if (!out_) return false;
+    if (validEnd == 0) {
+        encoded_.clear();
+        put<uint32_t>(encoded_, kArchiveMagic);
+        put<uint16_t>(encoded_, kArchiveVersion);
+        put<uint8_t>(encoded_, static_cast<uint8_t>(kind_));
+        put<uint8_t>(encoded_, 0);
+        put<uint64_t>(encoded_, 0);
+        out_.write(reinterpret_cast<const char*>(encoded_.data()), static_cast<std::streamsize>(encoded_.size()));
+        bytesWritten_ += encoded_.size();
+    }
+    return static_cast<bool>(out_);
+}
+
+void SeriesArchiveWriter::close() {
+    if (!out_.is_open()) return;
+    flush();
+    out_.close();
+}
+
+void SeriesArchiveWriter::append(const KlineData& candle) {
+    if (kind_ != ArchiveKind::Candles) return;
+    candles_.push_back(candle);
+    if (candles_.size() >= kArchiveBlockRows) writeBlock();
+}
+
+void SeriesArchiveWriter::append(uint64_t receiveTimeNs, const BBO& quote) {
+    if (kind_ != ArchiveKind::Quotes) return;
+    quotes_.push_back(receiveTimeNs, quote);
+    if (quotes_.size() >= kArchiveBlockRows) writeBlock();
+}
+
+bool SeriesArchiveWriter::flush() {
+    bool ok = writeBlock();
+    out_.flush();
+    return ok && static_cast<bool>(out_);
+}
+
+bool SeriesArchiveWriter::writeBlock() {
+    ColumnRefs cols = kind_ == ArchiveKind::Candles ? columnRefs(candles_) : columnRefs(quotes_);
+    size_t rows = cols.times[0]->size();
+    if (rows == 0) return true;
+    if (!out_.is_open()) {
+        truncateColumns(cols, 0);
+        return false;
+    }
+
+    encoded_.clear();
+    put<uint32_t>(encoded_, 0); // Payload size, filled in below
+    for (size_t c = 0; c < cols.timeCount; ++c) {
+        column_.clear();
+        encodeTimes(cols.times[c]->data(), rows, column_);
+        putVarint(encoded_, column_.size());
+        encoded_.insert(encoded_.end(), column_.begin(), column_.end());
+    }
+    for (size_t c = 0; c < cols.valueCount; ++c) {
+        column_.clear();
+        encodeValues(cols.values[c]->data(), rows, column_);
+        putVarint(encoded_, column_.size());
+        encoded_.insert(encoded_.end(), column_.begin(), column_.end());
+    }
+    uint32_t payloadSize = static_cast<uint32_t>(encoded_.size() - 4);
+    std::memcpy(encoded_.data(), &payloadSize, sizeof(payloadSize));
+
+    put<uint32_t>(encoded_, static_cast<uint32_t>(rows));
+    put<uint32_t>(encoded_, 0);
+    put<uint64_t>(encoded_, cols.times[0]->front());
+    put<uint64_t>(encoded_, cols.times[0]->back());
+    for (size_t c = 0; c < cols.valueCount; ++c) put<double>(encoded_, *std::min_element(cols.values[c]->begin(), cols.values[c]->end()));
+    for (size_t c = 0; c < cols.valueCount; ++c) put<double>(encoded_, *std::max_element(cols.values[c]->begin(), cols.values[c]->end()));
+
+    out_.write(reinterpret_cast<const char*>(encoded_.data()), static_cast<std::streamsize>(encoded_.size()));
+    bytesWritten_ += encoded_.size();
+    truncateColumns(cols, 0);
+    return static_cast<bool>(out_);
+}
+
+// ------------------ SeriesArchiveReader ------------------
+bool SeriesArchiveReader::open(const fs::path& path) {
+    data_.clear();
+    blocks_.clear();
+    rows_ = 0;
+
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) return false;
+    std::streamoff size = in.tellg();
+    if (size < static_cast<std::streamoff>(kFileHeaderSize)) return false;
+    data_.resize(static_cast<size_t>(size));
+    in.seekg(0);
+    if (!in.read(reinterpret_cast<char*>(data_.data()), size) || !readHeader(data_.data(), kind_)) {
+        data_.clear();
+        return false;
+    }
+
+    size_t footer = footerSize(kind_);
+    size_t pos = kFileHeaderSize;
+    while (pos + 4 <= data_.size()) {
+        ArchiveBlock block;
+        block.payloadOffset = pos + 4;
+        block.payloadSize = get<uint32_t>(data_.data() + pos);
+        size_t blockEnd = block.payloadOffset + block.payloadSize + footer;
+        if (blockEnd > data_.size() || !readFooter(data_.data() + block.payloadOffset + block.payloadSize, kind_, block)) break;
+        rows_ += block.rows;
+        blocks_.push_back(block);
+        pos = blockEnd;
+    }
+    return true;
+}
+
+size_t SeriesArchiveReader::decode(TimeRange range, CandleColumns& out) const {
+    if (kind_ != ArchiveKind::Candles) return 0;
+    return decodeRange(data_, blocks_, range, out);
+}
+
+size_t SeriesArchiveReader::decode(TimeRange range, QuoteColumns& out) const {
+    if (kind_ != ArchiveKind::Quotes) return 0;
+    return decodeRange(data_, blocks_, range, out);
+}
+
+size_t SeriesArchiveReader::decode(size_t block, TimeRange range, CandleColumns& out) const {
+    if (kind_ != ArchiveKind::Candles || block >= blocks_.size()) return 0;
+    size_t start = out.size();
+    decodeBlockRows(data_, blocks_[block], range, columnRefs(out));
+    return out.size() - start;
+}
+
+size_t SeriesArchiveReader::decode(size_t block, TimeRange range, QuoteColumns& out) const {
+    if (kind_ != ArchiveKind::Quotes || block >= blocks_.size()) return 0;
+    size_t start = out.size();
+    decodeBlockRows(data_, blocks_[block], range, columnRefs(out));
+    return out.size() - start;
+}
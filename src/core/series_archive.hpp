@@ -0,0 +1,133 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+#include "core/BBO.hpp"
+#include "core/binance_kline.hpp"
+#include "core/time_range.hpp"
+
+// Candles stored column by column: row i is element i of every vector
+struct CandleColumns {
+    std::vector<uint64_t> openTime;
+    std::vector<uint64_t> closeTime;
+    std::vector<double> open, high, low, close, volume;
+
+    size_t size() const { return openTime.size(); }
+    bool empty() const { return openTime.empty(); }
+    void clear();
+    void reserve(size_t rows);
+    void push_back(const KlineData& candle);
+    KlineData row(size_t i) const;
+};
+
+// Top-of-book quotes of one symbol, column by column
+struct QuoteColumns {
+    std::vector<uint64_t> timeNs; // Publisher receive time (epoch ns)
+    std::vector<double> bidPrice, bidQuantity, askPrice, askQuantity;
+
+    size_t size() const { return timeNs.size(); }
+    bool empty() const { return timeNs.empty(); }
+    void clear();
+    void reserve(size_t rows);
+    void push_back(uint64_t receiveTimeNs, const BBO& quote);
+};
+
+enum class ArchiveKind : uint8_t { Candles = 1, Quotes = 2 };
+
+// Most value (double) columns of any kind: the candles' open/high/low/close/volume
+inline constexpr size_t kArchiveMaxValues = 5;
+// Rows per block; only the last block written by a flush() can be shorter
+inline constexpr size_t kArchiveBlockRows = 4096;
+
+// One block as described by its footer
+struct ArchiveBlock {
+    size_t payloadOffset = 0; // Into the file
+    size_t payloadSize = 0;
+    uint32_t rows = 0;
+    uint64_t firstTime = 0;   // Open time (candles) or receive time (quotes) of the first row
+    uint64_t lastTime = 0;
+    std::array<double, kArchiveMaxValues> min{}; // Per value column, in the *Columns field order
+    std::array<double, kArchiveMaxValues> max{};
+};
+
+// Compressed, append-only columnar archive of one series (one symbol's candles of one
+// interval, or one symbol's quotes) for long-term recording.
+//
+// Rows are cut into blocks of kArchiveBlockRows. Inside a block every column is its own
+// bit stream: time columns as delta-of-delta codes (a regular series costs one bit a
+// row), value columns Gorilla-style, as the XOR with the previous value (an unchanged
+// price costs one bit, a small move only its changed mantissa bits). Blocks are
+// independent, so decoding starts at any block, and their footers let a reader skip
+// whole blocks by time or price range without touching the payload.
+//
+// File (little endian):
+//   header  u32 magic 'NKTA', u16 version, u8 kind, u8 reserved, u64 reserved
+//   blocks  u32 payloadSize, payload, footer
+//   payload per column: varint byte length, bit stream (MSB first); time columns first
+//   footer  u32 rows, u32 reserved, u64 firstTime, u64 lastTime,
+//           f64 min[value columns], f64 max[value columns]
+// A block cut short by a crash fails its size check and ends the archive there.
+class SeriesArchiveWriter {
+public:
+    explicit SeriesArchiveWriter(ArchiveKind kind);
+    ~SeriesArchiveWriter();
+
+    SeriesArchiveWriter(const SeriesArchiveWriter&) = delete;
+    SeriesArchiveWriter& operator=(const SeriesArchiveWriter&) = delete;
+
+    // Appends to `path`, writing the header if the file is new or empty.
+    // False if it cannot be opened or holds another kind of archive.
+    bool open(const std::filesystem::path& path);
+    // Flushes the buffered rows and closes the file
+    void close();
+
+    // Rows must arrive in time order; a full block is encoded and written at once
+    void append(const KlineData& candle);                      // ArchiveKind::Candles
+    void append(uint64_t receiveTimeNs, const BBO& quote);     // ArchiveKind::Quotes
+
+    // Write the buffered rows as a (short) block now
+    bool flush();
+
+    uint64_t bytesWritten() const { return bytesWritten_; }
+
+private:
+    bool writeBlock();
+
+    ArchiveKind kind_;
+    std::ofstream out_;
+    CandleColumns candles_; // Rows of the block being filled
+    QuoteColumns quotes_;
+    std::vector<uint8_t> encoded_; // Reused block scratch
+    std::vector<uint8_t> column_;  // Reused column scratch
+    uint64_t bytesWritten_ = 0;
+};
+
+// Reads a whole archive into memory (page cache permitting, a sequential read) and
+// indexes its block footers; decoding goes straight from there into the columns.
+class SeriesArchiveReader {
+public:
+    // False if the file is missing or not an archive; a torn final block is dropped
+    bool open(const std::filesystem::path& path);
+
+    ArchiveKind kind() const { return kind_; }
+    const std::vector<ArchiveBlock>& blocks() const { return blocks_; }
+    size_t rows() const { return rows_; }
+
+    // Append the rows with time in `range` (inclusive), skipping blocks outside it.
+    // Returns the number of rows appended; 0 for the other archive kind.
+    size_t decode(TimeRange range, CandleColumns& out) const;
+    size_t decode(TimeRange range, QuoteColumns& out) const;
+    // Same for the single block blocks()[block], for readers that walk the block
+    // index themselves and decode one block at a time
+    size_t decode(size_t block, TimeRange range, CandleColumns& out) const;
+    size_t decode(size_t block, TimeRange range, QuoteColumns& out) const;
+
+private:
+    std::vector<uint8_t> data_;
+    std::vector<ArchiveBlock> blocks_;
+    ArchiveKind kind_ = ArchiveKind::Candles;
+    size_t rows_ = 0;
+};
@@ -0,0 +1,92 @@
+#include "series_query.hpp"
+#include <algorithm>
+#include <utility>
+
+namespace {
+
+// [first, last) of the ascending `times` that lie in `range`
+std::pair<size_t, size_t> indexRange(std::span<const uint64_t> times, TimeRange range) {
+    auto first = std::lower_bound(times.begin(), times.end(), range.from);
+    auto last = std::upper_bound(first, times.end(), range.to);
+    return {static_cast<size_t>(first - times.begin()), static_cast<size_t>(last - times.begin())};
+}
+
+bool openedBefore(const KlineData& candle, uint64_t openTime) { return candle.open_time < openTime; }
+bool openedAfter(uint64_t openTime, const KlineData& candle) { return openTime < candle.open_time; }
+
+} // namespace
+
+// ------------------ CandleView ------------------
+CandleView CandleView::subview(size_t offset, size_t count) const {
+    return {openTime.subspan(offset, count), closeTime.subspan(offset, count),
+            open.subspan(offset, count), high.subspan(offset, count), low.subspan(offset, count),
+            close.subspan(offset, count), volume.subspan(offset, count)};
+}
+
+CandleView viewOf(const CandleColumns& columns) {
+    return {columns.openTime, columns.closeTime, columns.open, columns.high, columns.low,
+            columns.close, columns.volume};
+}
+
+// ------------------ Range queries ------------------
+CandleView queryRange(CandleView candles, TimeRange range) {
+    auto [first, last] = indexRange(candles.openTime, range);
+    return candles.subview(first, last - first);
+}
+
+CandleView queryRange(const CandleColumns& candles, TimeRange range) {
+    return queryRange(viewOf(candles), range);
+}
+
+std::span<const KlineData> queryRange(std::span<const KlineData> candles, TimeRange range) {
+    auto first = std::lower_bound(candles.begin(), candles.end(), range.from, openedBefore);
+    auto last = std::upper_bound(first, candles.end(), range.to, openedAfter);
+    return {first, last};
+}
+
+CandleStoreRange queryRange(const CandleStore& store, TimeRange range) {
+    const std::deque<KlineData>& candles = store.candles();
+    auto first = std::lower_bound(candles.begin(), candles.end(), range.from, openedBefore);
+    auto last = std::upper_bound(first, candles.end(), range.to, openedAfter);
+    return {first, last};
+}
+
+std::span<const Tick> queryRange(std::span<const Tick> ticks, std::string_view from, std::string_view to) {
+    auto first = ticks.begin();
+    if (!from.empty()) {
+        first = std::lower_bound(ticks.begin(), ticks.end(), from,
+                                 [](const Tick& tick, std::string_view date) { return tick.date < date; });
+    }
+    auto last = ticks.end();
+    if (!to.empty()) {
+        last = std::upper_bound(first, ticks.end(), to, [](std::string_view date, const Tick& tick) {
+            return date < std::string_view(tick.date).substr(0, date.size());
+        });
+    }
+    return {first, last};
+}
+
+// ------------------ ArchiveCandleCursor ------------------
+ArchiveCandleCursor::ArchiveCandleCursor(const SeriesArchiveReader& reader, TimeRange range)
+    : reader_(reader),
+      range_(range)
+{
+    // Blocks are in time order, so the first one ending at or after range.from starts the walk
+    const std::vector<ArchiveBlock>& blocks = reader_.blocks();
+    auto it = std::lower_bound(blocks.begin(), blocks.end(), range_.from,
+                               [](const ArchiveBlock& block, uint64_t t) { return block.lastTime < t; });
+    block_ = static_cast<size_t>(it - blocks.begin());
+}
+
+bool ArchiveCandleCursor::next() {
+    const std::vector<ArchiveBlock>& blocks = reader_.blocks();
+    chunk_.clear();
+    while (block_ < blocks.size() && blocks[block_].firstTime <= range_.to) {
+        size_t block = block_++;
+        if (reader_.decode(block, range_, chunk_) > 0) return true;
+        // A block in the range always has rows in it, so nothing decoded means a corrupt block
+        if (blocks[block].firstTime >= range_.from && blocks[block].lastTime <= range_.to) break;
+    }
+    block_ = blocks.size();
+    return false;
+}
@@ -0,0 +1,68 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <ranges>
+#include <span>
+#include <string_view>
+#include "core/binance_kline.hpp"
+#include "core/candle_store.hpp"
+#include "core/series_archive.hpp"
+#include "core/tick.hpp"
+#include "core/time_range.hpp"
+
+// Time-range queries over the historical series. Every query binary-searches the
+// series' own time order and hands back a view into storage that already exists, so
+// asking for "BTCUSDT 1m from T1 to T2" copies nothing: the spans go straight into the
+// indicators (smaCalc, macdCalc, ... take std::span) and the backtest engines.
+//
+// A view is only valid while the series it points into is alive and unchanged.
+
+// Candles as parallel column spans: row i is element i of every span
+struct CandleView {
+    std::span<const uint64_t> openTime;
+    std::span<const uint64_t> closeTime;
+    std::span<const double> open, high, low, close, volume;
+
+    size_t size() const { return openTime.size(); }
+    bool empty() const { return openTime.empty(); }
+    // Rows [offset, offset + count)
+    CandleView subview(size_t offset, size_t count) const;
+};
+
+// The whole of `columns`
+CandleView viewOf(const CandleColumns& columns);
+
+// Candles with open time in `range` (inclusive)
+CandleView queryRange(CandleView candles, TimeRange range);
+CandleView queryRange(const CandleColumns& candles, TimeRange range);
+std::span<const KlineData> queryRange(std::span<const KlineData> candles, TimeRange range);
+
+// A deque is not contiguous, so the live store answers with an iterator range
+using CandleStoreRange = std::ranges::subrange<std::deque<KlineData>::const_iterator>;
+CandleStoreRange queryRange(const CandleStore& store, TimeRange range);
+
+// Ticks dated in [from, to]. Dates are ISO strings, which sort as text; `to` matches as a
+// prefix, so "2024-03" ends after the last tick of March. An empty bound is open.
+std::span<const Tick> queryRange(std::span<const Tick> ticks, std::string_view from, std::string_view to);
+
+// Walks the candles of an on-disk archive in `range` one block at a time: the block
+// footers locate the first block by binary search, and each block is decoded into one
+// reused buffer, so a query over years of candles holds a single block in memory.
+//
+//   ArchiveCandleCursor cursor(reader, range);
+//   while (cursor.next()) use(cursor.chunk()); // chunk() is valid until the next next()
+class ArchiveCandleCursor {
+public:
+    ArchiveCandleCursor(const SeriesArchiveReader& reader, TimeRange range);
+
+    // Decode the next block overlapping the range; false once past it (or on a corrupt block)
+    bool next();
+    CandleView chunk() const { return viewOf(chunk_); }
+
+private:
+    const SeriesArchiveReader& reader_;
+    TimeRange range_;
+    size_t block_; // Next block to decode
+    CandleColumns chunk_;
+};
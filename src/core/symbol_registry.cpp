@@ -0,0 +1,27 @@
+#include "symbol_registry.hpp"
+#include <algorithm>
+
+SymbolRegistry::SymbolRegistry(std::vector<std::string> symbols)
+    : names_(std::move(symbols))
+{
+    std::sort(names_.begin(), names_.end());
+    names_.erase(std::unique(names_.begin(), names_.end()), names_.end());
+
+    fingerprint_ = 14695981039346656037ull;
+    for (const std::string& name : names_) {
+        for (unsigned char c : name) fingerprint_ = (fingerprint_ ^ c) * 1099511628211ull;
+        fingerprint_ = (fingerprint_ ^ '\n') * 1099511628211ull;
+    }
+}
+
+SymbolId SymbolRegistry::find(std::string_view symbol) const {
+    auto it = std::lower_bound(names_.begin(), names_.end(), symbol,
+        [](const std::string& name, std::string_view key) { return std::string_view(name) < key; });
+    if (it == names_.end() || *it != symbol) return kInvalidSymbolId;
+    return static_cast<SymbolId>(it - names_.begin());
+}
+
+const std::string& SymbolRegistry::name(SymbolId id) const {
+    static const std::string unknown = "[unknown]";
+    return id < names_.size() ? names_[id] : unknown;
+}
@@ -0,0 +1,37 @@
+#pragma once
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Dense integer handle for a symbol; index into registry-sized per-symbol arrays
+using SymbolId = uint32_t;
+inline constexpr SymbolId kInvalidSymbolId = std::numeric_limits<SymbolId>::max();
+
+// Interned symbol table, built once at load time and immutable afterwards,
+// so lookups need no locking from any thread.
+// Ids are positions in the sorted name list: deterministic for a given symbols file.
+class SymbolRegistry {
+public:
+    SymbolRegistry() = default;
+    explicit SymbolRegistry(std::vector<std::string> symbols); // Sorted + de-duplicated
+
+    // Binary search over the sorted names; kInvalidSymbolId if unknown
+    SymbolId find(std::string_view symbol) const;
+
+    const std::string& name(SymbolId id) const;
+    bool contains(SymbolId id) const { return id < names_.size(); }
+    size_t size() const { return names_.size(); }
+
+    // All names in id order (sorted)
+    const std::vector<std::string>& names() const { return names_; }
+
+    // FNV-1a over the names in id order, each followed by '\n'. Lets another process
+    // that sends bare ids (python/bookticker_batcher.py) prove it uses the same list.
+    uint64_t fingerprint() const { return fingerprint_; }
+
+private:
+    std::vector<std::string> names_;
+    uint64_t fingerprint_ = 0;
+};
@@ -0,0 +1,123 @@
+#include "symbol_search.hpp"
+#include <algorithm>
+#include <cctype>
+#include <iterator>
+
+static std::string toLower(std::string_view s) {
+    std::string lowered(s);
+    for (char& c : lowered) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    return lowered;
+}
+
+static uint32_t packTrigram(const char* p) {
+    return (uint32_t(uint8_t(p[0])) << 16) | (uint32_t(uint8_t(p[1])) << 8) | uint32_t(uint8_t(p[2]));
+}
+
+static bool startsWith(const std::string& s, const std::string& prefix) {
+    return s.compare(0, prefix.size(), prefix) == 0;
+}
+
+SymbolSearchIndex::SymbolSearchIndex(const SymbolRegistry& registry)
+    : registry_(registry)
+{
+    const auto& names = registry_.names();
+    lowered_.reserve(names.size());
+    byLowered_.reserve(names.size());
+
+    for (SymbolId id = 0; id < names.size(); ++id) {
+        lowered_.push_back(toLower(names[id]));
+        byLowered_.push_back(id);
+
+        const std::string& name = lowered_.back();
+        for (size_t i = 0; i + 3 <= name.size(); ++i) {
+            std::vector<SymbolId>& postings = trigrams_[packTrigram(name.data() + i)];
+            // Ids are visited in order, so postings stay sorted; skip repeats within one name
+            if (postings.empty() || postings.back() != id) postings.push_back(id);
+        }
+    }
+    std::sort(byLowered_.begin(), byLowered_.end(),
+              [this](SymbolId a, SymbolId b) { return lowered_[a] < lowered_[b]; });
+}
+
+void SymbolSearchIndex::search(std::string_view rawQuery, std::vector<SymbolId>& out) const {
+    out.clear();
+    const std::string query = toLower(rawQuery);
+
+    if (query.empty()) {
+        out = byLowered_;
+        return;
+    }
+
+    // Prefix matches: one contiguous run of the sorted lowercased names
+    auto first = std::lower_bound(byLowered_.begin(), byLowered_.end(), query,
+        [this](SymbolId id, const std::string& key) { return lowered_[id] < key; });
+    for (auto it = first; it != byLowered_.end() && startsWith(lowered_[*it], query); ++it) {
+        out.push_back(*it);
+    }
+
+    substringMatches(query, out);
+}
+
+// Appends ids containing `query` somewhere other than at the start
+void SymbolSearchIndex::substringMatches(const std::string& query, std::vector<SymbolId>& out) const {
+    auto isInnerMatch = [&](SymbolId id) {
+        const std::string& name = lowered_[id];
+        return !startsWith(name, query) && name.find(query) != std::string::npos;
+    };
+
+    if (query.size() < 3) {
+        // Too short for trigrams; still only a scan of short strings
+        for (SymbolId id = 0; id < lowered_.size(); ++id) {
+            if (isInnerMatch(id)) out.push_back(id);
+        }
+        return;
+    }
+
+    // Intersect posting lists, starting from the rarest trigram
+    std::vector<const std::vector<SymbolId>*> lists;
+    for (size_t i = 0; i + 3 <= query.size(); ++i) {
+        auto it = trigrams_.find(packTrigram(query.data() + i));
+        if (it == trigrams_.end()) return; // Some trigram never occurs: no substring match
+        lists.push_back(&it->second);
+    }
+    std::sort(lists.begin(), lists.end(), [](auto* a, auto* b) { return a->size() < b->size(); });
+
+    std::vector<SymbolId> candidates = *lists[0];
+    std::vector<SymbolId> scratch;
+    for (size_t l = 1; l < lists.size() && !candidates.empty(); ++l) {
+        scratch.clear();
+        std::set_intersection(candidates.begin(), candidates.end(), lists[l]->begin(), lists[l]->end(),
+                              std::back_inserter(scratch));
+        candidates.swap(scratch);
+    }
+
+    // Trigrams can match out of order; confirm the real substring
+    for (SymbolId id : candidates) {
+        if (isInnerMatch(id)) out.push_back(id);
+    }
+}
+
+bool SymbolSearchState::update(const SymbolSearchIndex& index, std::string_view rawQuery) {
+    std::string next = toLower(rawQuery);
+    if (initialized && next == query) return false;
+
+    if (initialized && !query.empty() && next.size() > query.size() && startsWith(next, query)) {
+        // Narrowing: every match of the longer query matched the shorter one,
+        // and prefix matches stay ahead of inner matches
+        std::vector<SymbolId> innerHits;
+        size_t kept = 0;
+        for (SymbolId id : results) {
+            const std::string& name = index.lowered(id);
+            if (startsWith(name, next)) results[kept++] = id;
+            else if (name.find(next) != std::string::npos) innerHits.push_back(id);
+        }
+        results.resize(kept);
+        results.insert(results.end(), innerHits.begin(), innerHits.end());
+    } else {
+        index.search(next, results);
+    }
+
+    query = std::move(next);
+    initialized = true;
+    return true;
+}
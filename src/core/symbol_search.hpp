@@ -0,0 +1,41 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "core/symbol_registry.hpp"
+
+// Prefix + trigram index over a SymbolRegistry (case-insensitive).
+// Prefix queries are an equal_range over the lowercased names in sorted order;
+// substring queries intersect trigram posting lists and verify the survivors.
+class SymbolSearchIndex {
+public:
+    explicit SymbolSearchIndex(const SymbolRegistry& registry);
+
+    // Ids matching `query` (case-insensitive): prefix matches first, then other substring matches.
+    // An empty query matches every symbol.
+    void search(std::string_view query, std::vector<SymbolId>& out) const;
+
+    const SymbolRegistry& registry() const { return registry_; }
+    const std::string& lowered(SymbolId id) const { return lowered_[id]; }
+
+private:
+    void substringMatches(const std::string& query, std::vector<SymbolId>& out) const;
+
+    const SymbolRegistry& registry_;
+    std::vector<std::string> lowered_;                             // Indexed by SymbolId
+    std::vector<SymbolId> byLowered_;                              // Ids sorted by lowercased name
+    std::unordered_map<uint32_t, std::vector<SymbolId>> trigrams_; // Packed trigram -> sorted ids
+};
+
+// Per-widget incremental search state: when the query only grows,
+// the previous results are filtered instead of searching the index again.
+struct SymbolSearchState {
+    std::string query;
+    std::vector<SymbolId> results;
+    bool initialized = false;
+
+    // Returns true when results changed
+    bool update(const SymbolSearchIndex& index, std::string_view rawQuery);
+};
@@ -10,93 +10,57 @@
 // EMA_t-1 = previous EMA
 
 // function that applies the EMA formula and pushes the current iteration's calculation to the EMA array
-void ema_point_adder(std::vector<double>& ema_pionts, const std::vector<Tick>& ticker_data, float& smoothing_factor, size_t iteration) {
+void ema_point_adder(std::vector<double>& ema_pionts, double current_value, float& smoothing_factor) {
     ema_pionts.push_back(
-        (smoothing_factor * ticker_data[iteration].close) 
+        (smoothing_factor * current_value) 
         + 
         (1 - smoothing_factor) * (ema_pionts.back())
     );
 }
 
 // GENERALIZED FOR OTHER CALCULATIONS
-// function that applies the EMA formula and pushes the current iteration's calculation to the EMA array
-void ema_point_adder(std::vector<double>& ema_pionts, const std::vector<double>& initial_vector, float& smoothing_factor, size_t iteration) {
-    ema_pionts.push_back(
-        (smoothing_factor * initial_vector[iteration]) 
-        + 
-        (1 - smoothing_factor) * (ema_pionts.back())
-    );
-}
-
-std::vector<double> emaCalc(int ema_interval, const std::vector<Tick>& ticker_data) {
+// value(i) gives the i-th input value: a tick's close, or an element of any other series
+template <typename Value>
+std::vector<double> ema_points_of(int ema_interval, size_t data_size, Value value) {
     std::vector<double> ema_points; // holds EMA points at each new corresponding price
     // chcek for edge cases
     if (ema_interval == 0) {
         fmt::print("Error: EMA interval of 0 not allowed!");
         return ema_points;
     }
-    if (ema_interval > ticker_data.size()) {
+    if (ema_interval > data_size) {
         fmt::print("Error: EMA interval is greater than data size!");
         return ema_points;
     }
     // reserve memory
-    ema_points.reserve(ticker_data.size() - ema_interval + 1);
+    ema_points.reserve(data_size - ema_interval + 1);
 
     float smoothing_factor = float(2) / (float(ema_interval) + 1);
 
     // very first point of an EMA is the SMA of hte first interval
     ema_points.push_back(0);
     for (size_t iterator = 0; iterator < ema_interval; iterator++) {
-        ema_points[0] += ticker_data[iterator].close;
+        ema_points[0] += value(iterator);
     }
     ema_points[0] = ema_points[0] / ema_interval;
 
     // chcck if the ema interval matches the current data size
-    if (ticker_data.size() == ema_interval) {
+    if (data_size == ema_interval) {
         return ema_points;
     }
     // call a funciton that adds to the EMA array
     // make sure to start at the index after which the first EMA point was calculated
-    for (size_t iterator = ema_interval; iterator < ticker_data.size(); iterator++) {
-        ema_point_adder(ema_points, ticker_data, smoothing_factor, iterator);
+    for (size_t iterator = ema_interval; iterator < data_size; iterator++) {
+        ema_point_adder(ema_points, value(iterator), smoothing_factor);
     }
 
     return ema_points;
 }
 
-// GENERALIZED FOR OTHER CALCULATIONS
-std::vector<double> emaCalc(int ema_interval, const std::vector<double>& initial_vector) {
-    std::vector<double> ema_points; // holds EMA points at each new corresponding price
-    // chcek for edge cases
-    if (ema_interval == 0) {
-        fmt::print("Error: EMA interval of 0 not allowed!");
-        return ema_points;
-    }
-    if (ema_interval > initial_vector.size()) {
-        fmt::print("Error: EMA interval is greater than data size!");
-        return ema_points;
-    }
-    // reserve memory
-    ema_points.reserve(initial_vector.size() - ema_interval + 1);
-
-    float smoothing_factor = float(2) / (float(ema_interval) + 1);
-
-    // very first point of an EMA is the SMA of hte first interval
-    ema_points.push_back(0);
-    for (size_t iterator = 0; iterator < ema_interval; iterator++) {
-        ema_points[0] += initial_vector[iterator];
-    }
-    ema_points[0] = ema_points[0] / ema_interval;
-
-    // chcck if the ema interval matches the current data size
-    if (initial_vector.size() == ema_interval) {
-        return ema_points;
-    }
-    // call a funciton that adds to the EMA array
-    // make sure to start at the index after which the first EMA point was calculated
-    for (size_t iterator = ema_interval; iterator < initial_vector.size(); iterator++) {
-        ema_point_adder(ema_points, initial_vector, smoothing_factor, iterator);
-    }
+std::vector<double> emaCalc(int ema_interval, std::span<const Tick> ticker_data) {
+    return ema_points_of(ema_interval, ticker_data.size(), [&](size_t i) { return ticker_data[i].close; });
+}
 
-    return ema_points;
-}
\ No newline at end of file
+std::vector<double> emaCalc(int ema_interval, std::span<const double> initial_vector) {
+    return ema_points_of(ema_interval, initial_vector.size(), [&](size_t i) { return initial_vector[i]; });
+}
@@ -1,6 +1,7 @@
 #pragma once
+#include <span>
 #include <vector>
 #include <core/tick.hpp>
 
-std::vector<double> emaCalc(int ema_interval, const std::vector<Tick>& ticker_data);
-std::vector<double> emaCalc(int ema_interval, const std::vector<double>& initial_vector);
\ No newline at end of file
+std::vector<double> emaCalc(int ema_interval, std::span<const Tick> ticker_data);
+std::vector<double> emaCalc(int ema_interval, std::span<const double> initial_vector);
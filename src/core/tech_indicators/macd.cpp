@@ -26,7 +26,9 @@ std::vector<double> histogramCalculator(std::vector<double>& macd_line, std::vec
     return histogram_vector;
 }
 
-MACDResult macdCalc(int fast_EMA_period, int slow_EMA_period, int signal_period, const std::vector<Tick>& ticker_data) {
+// Series is std::span<const Tick> or a bare close-price std::span<const double>; emaCalc takes either
+template <typename Series>
+MACDResult macd_of(int fast_EMA_period, int slow_EMA_period, int signal_period, Series ticker_data) {
     MACDResult macd_result;
     // check if any of the periods are zeroes
     if (fast_EMA_period == 0 || slow_EMA_period == 0 || signal_period == 0) {
@@ -121,4 +123,12 @@ MACDResult macdCalc(int fast_EMA_period, int slow_EMA_period, int signal_period,
     // hence:
     // starting_day = current_day + (slowEMAPeriod - 1) + (signal_Period - 1)
     return macd_result;
-}
\ No newline at end of file
+}
+
+MACDResult macdCalc(int fast_EMA_period, int slow_EMA_period, int signal_period, std::span<const Tick> ticker_data) {
+    return macd_of(fast_EMA_period, slow_EMA_period, signal_period, ticker_data);
+}
+
+MACDResult macdCalc(int fast_EMA_period, int slow_EMA_period, int signal_period, std::span<const double> close_prices) {
+    return macd_of(fast_EMA_period, slow_EMA_period, signal_period, close_prices);
+}
@@ -1,4 +1,5 @@
 #pragma once
+#include <span>
 #include <vector>
 #include <core/tick.hpp>
 
@@ -8,4 +9,6 @@ struct MACDResult {
     std::vector<double> histogram;
 };
 
-MACDResult macdCalc(int fast_EMA_period, int slow_EMA_period, int signal_period, const std::vector<Tick>& ticker_data);
\ No newline at end of file
+MACDResult macdCalc(int fast_EMA_period, int slow_EMA_period, int signal_period, std::span<const Tick> ticker_data);
+// Same over a bare close-price column (e.g. a CandleView's close)
+MACDResult macdCalc(int fast_EMA_period, int slow_EMA_period, int signal_period, std::span<const double> close_prices);
\ No newline at end of file
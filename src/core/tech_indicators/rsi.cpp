@@ -24,7 +24,9 @@ void rsi_point_adder (std::vector<double>& rsi_points, double& average_gains, do
     );
 }
 
-std::vector<double> rsiCalc (int rsi_interval, const std::vector<Tick>& ticker_data) {
+// close(i) gives the close of the i-th data point, so ticks and bare price columns share one loop
+template <typename Close>
+std::vector<double> rsi_points_of(int rsi_interval, size_t data_size, Close close) {
     std::vector<double> rsi_points; // vector holding rsi points
     
     // check for edge cases
@@ -33,19 +35,19 @@ std::vector<double> rsiCalc (int rsi_interval, const std::vector<Tick>& ticker_d
         fmt::print("Error: RSI interval cannot be zero!");
         return rsi_points;
     }
-    if (rsi_interval > ticker_data.size()) {
+    if (rsi_interval > data_size) {
         fmt::print("Error: RSI interval is larger than the dataset!");
         return rsi_points;
     }
 
-    rsi_points.reserve(ticker_data.size() - rsi_interval);
+    rsi_points.reserve(data_size - rsi_interval);
 
     double average_gains = 0;
     double average_losses = 0;
 
     // calculate the first initial RSI value
     for (size_t iterator = 1; iterator < rsi_interval; iterator++) { // use rsi_interval for just the first rsi values
-        double difference =  (ticker_data[iterator].close - ticker_data[iterator - 1].close);
+        double difference =  (close(iterator) - close(iterator - 1));
         // handle gains or losses or neither
         if (difference > 0) {
             average_gains += difference / rsi_interval;
@@ -56,14 +58,14 @@ std::vector<double> rsiCalc (int rsi_interval, const std::vector<Tick>& ticker_d
     rsi_points.push_back(100 - ( 100 / (1 + average_gains / average_losses)));
 
     // check if the RSI interval is the same as the dataset size
-    if (rsi_interval == ticker_data.size()) {
+    if (rsi_interval == data_size) {
         return rsi_points;
     }
 
     // calculate and add RSI points iteratively
-    for (size_t iterator = rsi_interval; iterator < ticker_data.size(); iterator++) {
+    for (size_t iterator = rsi_interval; iterator < data_size; iterator++) {
         double current_new_difference = (
-            ticker_data[iterator].close - ticker_data[iterator - 1].close
+            close(iterator) - close(iterator - 1)
         );
         // calculate the new current gain/loss/neither
         if (current_new_difference != 0) {
@@ -83,4 +85,12 @@ std::vector<double> rsiCalc (int rsi_interval, const std::vector<Tick>& ticker_d
     }
 
     return rsi_points;
-}
\ No newline at end of file
+}
+
+std::vector<double> rsiCalc (int rsi_interval, std::span<const Tick> ticker_data) {
+    return rsi_points_of(rsi_interval, ticker_data.size(), [&](size_t i) { return ticker_data[i].close; });
+}
+
+std::vector<double> rsiCalc (int rsi_interval, std::span<const double> close_prices) {
+    return rsi_points_of(rsi_interval, close_prices.size(), [&](size_t i) { return close_prices[i]; });
+}
@@ -1,5 +1,8 @@
 #pragma once
+#include <span>
 #include <vector>
 #include "core/tick.hpp"
 
-std::vector<double> rsiCalc (int rsi_interval, const std::vector<Tick>& ticker_data);
\ No newline at end of file
+std::vector<double> rsiCalc (int rsi_interval, std::span<const Tick> ticker_data);
+// Same over a bare close-price column (e.g. a CandleView's close)
+std::vector<double> rsiCalc (int rsi_interval, std::span<const double> close_prices);
@@ -1,14 +1,13 @@
-#include <core/tick.hpp>
-#include <vector>
+#include "sma.hpp"
 //#include <string>
 #include <fmt/core.h>
 
 // SMA of n = (price_1 + price_2 + ... + price_n) / n
 
-std::vector<double> smaCalc(int sma_interval, const std::vector<Tick>& ticker_data) { 
+// price(i) gives the price of the i-th data point, so ticks and bare price columns share one loop
+template <typename Price>
+std::vector<double> sma_points_of(int sma_interval, size_t data_size, Price price) {
     std::vector<double> sma_points; // holds SMA points at each new corresponding price
-    // reserve memory for efficiency/performance
-    sma_points.reserve(ticker_data.size() - sma_interval + 1);
 
     // check for edge case
     // Avoid divide by zero edge case or an not calculable SMA
@@ -17,32 +16,41 @@ std::vector<double> smaCalc(int sma_interval, const std::vector<Tick>& ticker_da
         return sma_points;
     }
     // Avoid calculatoin of indeterminate SMAs
-    if (sma_interval > ticker_data.size()) {
+    if (sma_interval > data_size) {
         fmt::print("Error: SMA interval size larger than provided data size!");
         return sma_points;
     }
+    // reserve memory for efficiency/performance
+    sma_points.reserve(data_size - sma_interval + 1);
 
     // get the first SMA dataset to calculate from
     double rolling_sum = 0; // rolling sum
     for (size_t iterator = 0; iterator < sma_interval; iterator++) {
-        rolling_sum += ticker_data[iterator].close;
+        rolling_sum += price(iterator);
     }
     sma_points.push_back(rolling_sum / sma_interval);
 
     // check if the SMA interval is equal to the dataset size and avoid out-of-bounds error:
-    if (ticker_data.size() == sma_interval) {
+    if (data_size == sma_interval) {
         return sma_points;
     }
     
     // iteratively calculate the new SMA at every new data point
-    for (size_t iterator = sma_interval; iterator < ticker_data.size(); iterator++) {
+    for (size_t iterator = sma_interval; iterator < data_size; iterator++) {
         // subtract the current "head" value
-        rolling_sum -= ticker_data[iterator - sma_interval].close;
+        rolling_sum -= price(iterator - sma_interval);
         // add the current "tail" value
-        rolling_sum += ticker_data[iterator].close;
+        rolling_sum += price(iterator);
         // add the current new SMA value
         sma_points.push_back(rolling_sum / sma_interval);
     }
     return sma_points;
 }
 
+std::vector<double> smaCalc(int sma_interval, std::span<const Tick> ticker_data) { 
+    return sma_points_of(sma_interval, ticker_data.size(), [&](size_t i) { return ticker_data[i].close; });
+}
+
+std::vector<double> smaCalc(int sma_interval, std::span<const double> close_prices) {
+    return sma_points_of(sma_interval, close_prices.size(), [&](size_t i) { return close_prices[i]; });
+}
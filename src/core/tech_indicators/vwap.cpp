@@ -5,32 +5,50 @@
 //           sum of price_i * volume_i from i to n
 //  VWAP =  ---------------------------------------
 //               sum of volume_i from i to n
-std::vector<double> vwapCalc (const std::vector<Tick>& ticker_data) {
+// close(i) and volume(i) give the i-th data point's close and volume
+template <typename Close, typename Volume>
+std::vector<double> vwap_points_of(size_t data_size, Close close, Volume volume) {
     std::vector<double> vwap_points;
     double total_volume = 0.0;
 
     // check for edge cases
-    if (ticker_data.size() == 0) {
+    if (data_size == 0) {
         fmt::print("Error: No ticker data found!");
         return vwap_points;
     }
     // get the very first volume value checked
-    if (ticker_data[0].volume == 0) {
+    if (volume(0) == 0) {
         fmt::print("Error: Volume sum for first iteration is zero; leads to divide by zero error!");
         return vwap_points;
     }
 
     // reserve the vwap vector size for performance
-    vwap_points.reserve(ticker_data.size());
+    vwap_points.reserve(data_size);
     double volume_weighted_price_sum = 0;
 
-    // append the VWAP at each index of ticker_data vector
-    for (size_t iterator = 0; iterator < ticker_data.size(); iterator++) {
+    // append the VWAP at each data point
+    for (size_t iterator = 0; iterator < data_size; iterator++) {
         // get total volume up to the n iteration
-        total_volume += ticker_data[iterator].volume;
-        volume_weighted_price_sum += ticker_data[iterator].close * ticker_data[iterator].volume;
+        total_volume += volume(iterator);
+        volume_weighted_price_sum += close(iterator) * volume(iterator);
         vwap_points.push_back(volume_weighted_price_sum / total_volume);
     }
 
     return vwap_points;
-}
\ No newline at end of file
+}
+
+std::vector<double> vwapCalc (std::span<const Tick> ticker_data) {
+    return vwap_points_of(ticker_data.size(),
+                          [&](size_t i) { return ticker_data[i].close; },
+                          [&](size_t i) { return static_cast<double>(ticker_data[i].volume); });
+}
+
+std::vector<double> vwapCalc (std::span<const double> close_prices, std::span<const double> volumes) {
+    if (close_prices.size() != volumes.size()) {
+        fmt::print("Error: close price and volume columns differ in length!");
+        return {};
+    }
+    return vwap_points_of(close_prices.size(),
+                          [&](size_t i) { return close_prices[i]; },
+                          [&](size_t i) { return volumes[i]; });
+}
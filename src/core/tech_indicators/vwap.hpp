@@ -1,5 +1,8 @@
 #pragma once
+#include <span>
 #include <vector>
 #include <core/tick.hpp>
 
-std::vector<double> vwapCalc (const std::vector<Tick>& tickerData);
\ No newline at end of file
+std::vector<double> vwapCalc (std::span<const Tick> tickerData);
+// Same over close-price and volume columns of equal length (e.g. a CandleView's)
+std::vector<double> vwapCalc (std::span<const double> close_prices, std::span<const double> volumes);
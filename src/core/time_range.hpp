@@ -0,0 +1,8 @@
+#pragma once
+#include <cstdint>
+
+// Inclusive range of timestamps, in whatever unit the series uses (ms for candles)
+struct TimeRange {
+    uint64_t from = 0;
+    uint64_t to = 0;
+};
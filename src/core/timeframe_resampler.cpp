@@ -0,0 +1,111 @@
+#include "timeframe_resampler.hpp"
+#include <algorithm>
+
+namespace {
+
+// Fold `next` (a later base bar of the same bucket) into `bar`
+void fold(KlineData& bar, const KlineData& next) {
+    bar.high = std::max(bar.high, next.high);
+    bar.low = std::min(bar.low, next.low);
+    bar.close = next.close;
+    bar.volume += next.volume;
+}
+
+KlineData startBucket(const KlineData& base, uint64_t bucket, uint64_t intervalMs) {
+    return KlineData{bucket, base.open, base.high, base.low, base.close, base.volume, bucket + intervalMs - 1};
+}
+
+} // namespace
+
+TimeframeResampler::TimeframeResampler(const std::vector<uint64_t>& intervalsMs, size_t maxBars)
+{
+    timeframes_.reserve(intervalsMs.size());
+    for (uint64_t interval : intervalsMs) timeframes_.emplace_back(interval, maxBars);
+}
+
+CandleChange TimeframeResampler::takeChange(size_t tf) {
+    CandleChange change = timeframes_[tf].pendingChange;
+    timeframes_[tf].pendingChange = CandleChange{};
+    return change;
+}
+
+void TimeframeResampler::store(Timeframe& tf, const KlineData& bar) {
+    tf.pendingChange.merge(tf.bars.upsert(bar));
+}
+
+void TimeframeResampler::update(const std::deque<KlineData>& base, const CandleChange& change) {
+    if (change.trimmed) baseTrimmed_ = true;
+    if (base.empty() || change.first >= base.size()) return;
+
+    for (Timeframe& tf : timeframes_) {
+        bool onlyNewest = change.first == base.size() - 1;
+        bool forward = tf.prefixBucket == UINT64_MAX || tf.bucketOf(base.back().open_time) >= tf.prefixBucket;
+        if (onlyNewest && forward) updateForming(tf, base);
+        else rebuildFrom(tf, base, change.first);
+    }
+}
+
+// Fast path: only the newest base bar changed (or was appended)
+void TimeframeResampler::updateForming(Timeframe& tf, const std::deque<KlineData>& base) {
+    const KlineData& newest = base.back();
+    uint64_t bucket = tf.bucketOf(newest.open_time);
+    if (bucket != tf.prefixBucket) {
+        tf.prefixBucket = bucket;
+        tf.prefixCount = 0;
+        tf.prefixLastOpen = 0;
+    }
+
+    // Base bars that closed since the last update join the prefix (normally zero or one)
+    size_t i = base.size() - 1;
+    while (i > 0 && base[i - 1].open_time > tf.prefixLastOpen && tf.bucketOf(base[i - 1].open_time) == bucket) --i;
+    for (; i < base.size() - 1; ++i) {
+        if (tf.prefixCount++ == 0) tf.prefix = startBucket(base[i], bucket, tf.intervalMs);
+        else fold(tf.prefix, base[i]);
+        tf.prefixLastOpen = base[i].open_time;
+    }
+
+    KlineData bar = tf.prefixCount ? tf.prefix : startBucket(newest, bucket, tf.intervalMs);
+    if (tf.prefixCount) fold(bar, newest);
+    store(tf, bar);
+}
+
+// Slow path: recompute every bucket from the one holding base[first] to the newest
+void TimeframeResampler::rebuildFrom(Timeframe& tf, const std::deque<KlineData>& base, size_t first) {
+    uint64_t bucket = tf.bucketOf(base[first].open_time);
+    while (first > 0 && tf.bucketOf(base[first - 1].open_time) == bucket) --first;
+
+    // A bucket that began before base.front() lost bars to the trim, so its stored bar is
+    // more complete than a rebuild would be: leave it, or if it is the forming bucket,
+    // let the fast path carry on from the prefix that still holds the trimmed bars
+    uint64_t head = tf.bucketOf(base.front().open_time);
+    if (first == 0 && baseTrimmed_ && head < base.front().open_time) {
+        while (first < base.size() && tf.bucketOf(base[first].open_time) == head) ++first;
+        if (first == base.size()) {
+            updateForming(tf, base);
+            return;
+        }
+    }
+
+    KlineData bar{};
+    size_t inBucket = 0;
+    for (size_t i = first; i < base.size(); ++i) {
+        uint64_t b = tf.bucketOf(base[i].open_time);
+        if (inBucket && b != bucket) {
+            store(tf, bar);
+            inBucket = 0;
+        }
+        bucket = b;
+
+        if (i == base.size() - 1) {
+            // Leave the prefix ready for the fast path
+            tf.prefixBucket = bucket;
+            tf.prefixCount = inBucket;
+            tf.prefixLastOpen = inBucket ? base[i - 1].open_time : 0;
+            if (inBucket) tf.prefix = bar;
+        }
+
+        if (inBucket++ == 0) bar = startBucket(base[i], bucket, tf.intervalMs);
+        else fold(bar, base[i]);
+    }
+    if (inBucket) store(tf, bar);
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+#include "core/binance_kline.hpp"
+#include "core/candle_store.hpp"
+
+// Chart timeframes. 1s and 1m are built from trades/klines; the rest are resampled from 1m.
+enum ChartTimeframe : size_t { kTf1s, kTf1m, kTf5m, kTf15m, kTf1h, kTf1d, kTimeframeCount };
+inline constexpr uint64_t kTimeframeMs[kTimeframeCount] = {1'000, 60'000, 300'000, 900'000, 3'600'000, 86'400'000};
+inline constexpr const char* kTimeframeNames[kTimeframeCount] = {"1s", "1m", "5m", "15m", "1h", "1d"};
+
+// Derives higher-timeframe candles from a base series, incrementally.
+//
+// The common update (only the newest base bar changed) touches just the forming
+// higher-timeframe bar: the closed base bars of its bucket are kept pre-folded, so the
+// cost is O(1) however long the timeframe. Older base changes (backfill) recompute only
+// the buckets from the first changed base bar onwards. Once the base series has dropped
+// bars from its front, the bucket they started is never recomputed from what is left:
+// its stored bar still has them.
+class TimeframeResampler {
+public:
+    // Each interval must be a multiple of the base series' interval
+    TimeframeResampler(const std::vector<uint64_t>& intervalsMs, size_t maxBars = 500);
+
+    // Apply a change of the base series (`change` as reported by its CandleStore)
+    void update(const std::deque<KlineData>& base, const CandleChange& change);
+
+    size_t timeframeCount() const { return timeframes_.size(); }
+    uint64_t intervalMs(size_t tf) const { return timeframes_[tf].intervalMs; }
+    const std::deque<KlineData>& bars(size_t tf) const { return timeframes_[tf].bars.candles(); }
+
+    // Everything changed in timeframe `tf` since the last call
+    CandleChange takeChange(size_t tf);
+
+private:
+    struct Timeframe {
+        uint64_t intervalMs;
+        CandleStore bars;
+        CandleChange pendingChange;
+        // Fold of the forming bucket's base bars, excluding the newest base bar
+        uint64_t prefixBucket = UINT64_MAX;
+        uint64_t prefixLastOpen = 0; // open_time of the newest base bar in the prefix
+        size_t prefixCount = 0;
+        KlineData prefix{};
+
+        Timeframe(uint64_t interval, size_t maxBars) : intervalMs(interval), bars(maxBars) {}
+        uint64_t bucketOf(uint64_t timeMs) const { return timeMs - timeMs % intervalMs; }
+    };
+
+    void updateForming(Timeframe& tf, const std::deque<KlineData>& base);
+    void rebuildFrom(Timeframe& tf, const std::deque<KlineData>& base, size_t first);
+    void store(Timeframe& tf, const KlineData& bar);
+
+    std::vector<Timeframe> timeframes_;
+    bool baseTrimmed_ = false; // The base series has dropped bars from its front
+};
@@ -0,0 +1,10 @@
+#pragma once
+#include <cstdint>
+
+// Normalized single trade (Binance <symbol>@trade)
+struct TradeData {
+    uint64_t trade_time;   // Trade time (ms)
+    double price;
+    double quantity;
+    bool is_buyer_maker;
+};
@@ -1,11 +1,12 @@
 #pragma once
 #include <string>
 #include "core/BBO.hpp"
+#include "core/symbol_registry.hpp"
 
 // Intent: what a window wants to view
 struct SymbolRequest {
     int windowID;          // Unique ID of the window
-    std::string requestedSymbol; // The symbol the window wants
+    SymbolId requestedSymbol;    // The symbol the window wants
     std::string requestType;    // Type of request ("stream", "close")
 };
 
@@ -13,6 +14,6 @@ struct SymbolRequest {
 struct WindowBBO {
     bool active = false;        // Is the window active
     int windowID;           // Unique ID of the window
-    std::string desiredSymbol; // The symbol the window desires to view
+    SymbolId desiredSymbol = kInvalidSymbolId; // The symbol the window desires to view
     BBO currentBBO;      // Current BBO data for the window
 };
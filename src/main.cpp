@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <vector>
 #include <deque>
 #include <fstream>
@@ -5,6 +6,10 @@
 #include <filesystem>
 #include <thread>
 #include <chrono>
+#include <future>
+#include <memory>
+#include <cstdlib>
+#include <sstream>
 #include <fmt/core.h>
 
 // Utils & Logging
@@ -18,11 +23,17 @@
 #include "core/BBO.hpp"
 #include "core/BinanceBookTickerDecoder.hpp"
 #include "core/SymbolRequest.hpp"
+#include "core/symbol_registry.hpp"
+#include "core/symbol_search.hpp"
+#include "core/market_data_pipeline.hpp"
+#include "core/kline_cache.hpp"
 
 // Networking
-#include "core/net/zmq_subscriber.hpp"
+#include "core/net/zmq_transport.hpp"
 #include "core/net/python_launcher.hpp"
+#include "core/net/port_guard.hpp"
 #include "core/net/zmq_control_client.hpp"
+#include "core/net/binance_ws_feed.hpp"
 
 // UI
 #include "ui/core/init.hpp"
@@ -57,24 +68,83 @@ fs::path getExecutableDir() {
 #endif
 }
 
-void forceClosePorts(FileLogger& logger) {
-#ifdef _WIN32
-    logger.logInfo("[INFO] Forcibly closing lingering ZMQ ports ...");
-    std::wstring cmd = L"powershell -Command \"$ports = @(5555, 5556, 5560, 5561); "
-                       L"$ports | ForEach-Object { Get-NetTCPConnection -LocalPort $_ -ErrorAction SilentlyContinue | "
-                       L"ForEach-Object { try { Stop-Process -Id $_.OwningProcess -Force -ErrorAction SilentlyContinue } catch {} } }\"";
-    STARTUPINFOW si{}; PROCESS_INFORMATION pi{}; si.cb = sizeof(si); si.dwFlags = STARTF_USESHOWWINDOW; si.wShowWindow = SW_HIDE;
-    std::wstring mutableCmd = cmd;
-    if (CreateProcessW(nullptr, mutableCmd.data(), nullptr, nullptr, FALSE, CREATE_NO_WINDOW, nullptr, nullptr, &si, &pi)) {
-        WaitForSingleObject(pi.hProcess, INFINITE);
-        CloseHandle(pi.hProcess); CloseHandle(pi.hThread);
+// Feed and control ports a previous run may have left bound (see used_ports.txt)
+static const std::vector<uint16_t> kFeedPorts{5555, 5556, 5560, 5561};
+
+// Control requests wait for the publisher's readiness message; past this they go out anyway
+static constexpr std::chrono::seconds kPublisherReadyTimeout(10);
+
+// Chart history kept filled: one day of 1m candles, all the pipeline's 1m base holds
+static constexpr std::chrono::hours kChartHistory(24);
+
+static TimeRange chartHistoryRange() {
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    auto from = now - kChartHistory;
+    return {static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(from).count()),
+            static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(now).count())};
+}
+
+struct LoadedSymbols {
+    std::unique_ptr<SymbolRegistry> registry;
+    std::unique_ptr<SymbolSearchIndex> search;
+    std::string chartSymbolName; // First entry of the file, not the first id
+    std::string error;
+};
+
+// Parses binance_symbols.json and builds the registry and search index; runs on a
+// worker thread while the window is created
+LoadedSymbols loadSymbols(const fs::path& symbolsFile) {
+    LoadedSymbols loaded;
+    std::ifstream symbolsStream(symbolsFile, std::ios::binary);
+    if (!symbolsStream.is_open()) {
+        loaded.error = fmt::format("Failed to open symbols file at {}", symbolsFile.string());
+        return loaded;
     }
-#else
-    system("lsof -i :5555 -t | xargs -r kill -9");
-    system("lsof -i :5556 -t | xargs -r kill -9");
-    system("lsof -i :5560 -t | xargs -r kill -9");
-    system("lsof -i :5561 -t | xargs -r kill -9");
-#endif
+    std::string text((std::istreambuf_iterator<char>(symbolsStream)), std::istreambuf_iterator<char>());
+    json symbolsJson = json::parse(text, nullptr, false);
+    if (symbolsJson.is_discarded() || !symbolsJson.is_array()) {
+        loaded.error = fmt::format("Malformed symbols file at {}", symbolsFile.string());
+        return loaded;
+    }
+
+    std::vector<std::string> symbolNames;
+    symbolNames.reserve(symbolsJson.size());
+    for (const auto& symbol : symbolsJson) {
+        if (symbol.is_string()) symbolNames.push_back(symbol.get<std::string>());
+    }
+    if (!symbolNames.empty()) loaded.chartSymbolName = symbolNames[0];
+
+    // Intern once; everything downstream passes SymbolIds
+    loaded.registry = std::make_unique<SymbolRegistry>(std::move(symbolNames));
+    loaded.search = std::make_unique<SymbolSearchIndex>(*loaded.registry);
+    return loaded;
+}
+
+// NIKTRADE_FEED_CPUS="2,3" pins the feed poller and libzmq I/O threads to those CPUs
+Binance::ZMQTransportConfig transportConfigFromEnv(FileLogger& logger) {
+    Binance::ZMQTransportConfig config;
+
+    // NIKTRADE_SHM_RING=<file>: the Python publisher (which inherits the variable) writes
+    // its feeds to this shared-memory ring and the transport reads it instead of ZMQ
+    if (const char* ring = std::getenv("NIKTRADE_SHM_RING")) {
+        if (Binance::kShmRingSupported) {
+            config.shmRingPath = ring;
+            logger.logInfo(fmt::format("[INFO] Feed transport using shared-memory ring: {}", ring));
+        } else {
+            logger.logInfo("[WARN] NIKTRADE_SHM_RING ignored: the shared-memory ring needs an x86 CPU");
+        }
+    }
+
+    const char* cpus = std::getenv("NIKTRADE_FEED_CPUS");
+    if (!cpus) return config;
+
+    std::stringstream ss(cpus);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        try { config.cpuAffinity.push_back(std::stoi(item)); } catch (...) {}
+    }
+    logger.logInfo(fmt::format("[INFO] Feed transport CPU affinity: {}", cpus));
+    return config;
 }
 
 // --------------------------- Main ---------------------------
@@ -97,18 +167,23 @@ int main() {
     FileLogger logger("NikTrade.log");
     logger.logInfo("Starting NikTrade...");
 
-    forceClosePorts(logger);
+    // NIKTRADE_EXTERNAL_FEED=1: a publisher is already running (e.g. niktrade_loadgen),
+    // so leave its ports alone and do not launch the Python feed
+    const bool externalFeed = std::getenv("NIKTRADE_EXTERNAL_FEED") != nullptr;
+    if (!externalFeed) NikTrade::releasePorts(kFeedPorts, logger);
 
-    // ------------------ Window/UI ------------------
+    // ------------------ Load Symbols (worker thread) ------------------
     fs::path exeDir = getExecutableDir();
-    GLFWwindow* window = initWindow(1000, 750, "NikTrade", exeDir);
-    if (!window) { logger.logInfo("Failed to initialize window."); return -1; }
-    logger.logInfo("Window initialized successfully.");
+    std::future<LoadedSymbols> symbolsLoad = std::async(std::launch::async, loadSymbols, exeDir / "python" / "binance_symbols.json");
 
     // ------------------ Python Publisher ------------------
+    // Launched first: interpreter startup is the longest step, and it overlaps with the
+    // window and symbol table. Nothing waits for it here; see publisherReady below.
     fs::path pythonScript = exeDir / "python" / "main.py";
     std::unique_ptr<NikTrade::PythonLauncher> pythonLauncher;
-    if (!fs::exists(pythonScript)) {
+    if (externalFeed) {
+        logger.logInfo("[INFO] Using external feed publisher.");
+    } else if (!fs::exists(pythonScript)) {
         logger.logInfo(fmt::format("Python publisher not found at: {}", pythonScript.string()));
     } else {
         pythonLauncher = std::make_unique<NikTrade::PythonLauncher>(
@@ -117,21 +192,23 @@ int main() {
             "python"
         );
         pythonLauncher->start();
-        std::this_thread::sleep_for(std::chrono::seconds(2)); // allow Python to initialize
         logger.logInfo("Python publisher started.");
     }
 
-    // ------------------ Load Symbols ------------------
-    std::vector<std::string> symbols;
-    symbols.reserve(14000); // Reserve space for symbols from Binance + NASDAQ Basic securities
-    fs::path symbolsFile = exeDir / "python" / "binance_symbols.json";
-    std::ifstream symbolsStream(symbolsFile);
-    if (!symbolsStream.is_open()) {
-        logger.logInfo(fmt::format("Failed to open symbols file at {}", symbolsFile.string()));
+    // ------------------ Window/UI ------------------
+    GLFWwindow* window = initWindow(1000, 750, "NikTrade", exeDir);
+    if (!window) { logger.logInfo("Failed to initialize window."); return -1; }
+    logger.logInfo("Window initialized successfully.");
+
+    // ------------------ Symbols ------------------
+    LoadedSymbols loadedSymbols = symbolsLoad.get();
+    if (!loadedSymbols.registry) {
+        logger.logInfo(loadedSymbols.error);
         return -1;
     }
-    json symbolsJson; symbolsStream >> symbolsJson;
-    for (const auto& symbol : symbolsJson) symbols.push_back(symbol.get<std::string>());
+    const SymbolRegistry& symbols = *loadedSymbols.registry;
+    const SymbolSearchIndex& symbolSearch = *loadedSymbols.search;
+    const std::string chartSymbolName = loadedSymbols.chartSymbolName;
     logger.logInfo(fmt::format("Loaded {} symbols.", symbols.size()));
 
     /*
@@ -143,13 +220,53 @@ int main() {
     std::vector<Tick> tickDataVector = json_to_tickDataVector(jsonData);
     logger.logInfo(fmt::format("Loaded {} ticks from JSON.", tickDataVector.size()));
     */
-    // ------------------ ZMQ Subscribers ------------------
-    Binance::ZMQSubscriber bookticker_sub(524288, "tcp://127.0.0.1:5555"); bookticker_sub.start();
-    Binance::ZMQSubscriber kline_sub(262144, "tcp://127.0.0.1:5556"); kline_sub.start();
-    Binance::ZMQSubscriber latency_sub(1024, "tcp://127.0.0.1:5561"); latency_sub.start();
+    // ------------------ ZMQ Transport ------------------
+    // One context + one poller thread for every feed (see used_ports.txt)
+    Binance::ZMQTransport transport(symbols, transportConfigFromEnv(logger));
+    Binance::ZMQSubscriber& bookticker_sub = transport.subscribe("tcp://127.0.0.1:5555", "bookticker.", 524288, true);
+    Binance::ZMQSubscriber& bookticker_batch_sub = transport.subscribe("tcp://127.0.0.1:5555", "bookticker_batch", 16384);
+    Binance::ZMQSubscriber& depth_sub = transport.subscribe("tcp://127.0.0.1:5555", "depth.", 65536, true);
+    Binance::ZMQSubscriber& kline_sub = transport.subscribe("tcp://127.0.0.1:5556", "klines.", 262144);
+    Binance::ZMQSubscriber& trade_sub = transport.subscribe("tcp://127.0.0.1:5556", "trade.", 262144);
+    Binance::ZMQSubscriber& latency_sub = transport.subscribe("tcp://127.0.0.1:5561", "feed_latency", 1024);
+    transport.start();
     logger.logInfo("ZMQ subscribers started.");
 
-    ZMQControlClient controlClient("tcp://127.0.0.1:5560");
+    // ------------------ Native Websocket Feed ------------------
+    // NIKTRADE_NATIVE_FEED=1 (Binance.US) or =<ws[s]://host:port/stream>: bookticker, live
+    // klines and trades come straight from the exchange instead of through the Python hop.
+    // Python still serves depth, REST backfills and the latency feed.
+    std::unique_ptr<Binance::BinanceWsFeed> nativeFeed;
+    if (const char* nativeUrl = std::getenv("NIKTRADE_NATIVE_FEED")) {
+        Binance::WsFeedConfig feedConfig = std::string(nativeUrl) == "1" ? Binance::WsFeedConfig{} : Binance::wsFeedConfigFromUrl(nativeUrl);
+        nativeFeed = std::make_unique<Binance::BinanceWsFeed>(symbols, feedConfig, logger, [&transport] { transport.notifyData(); });
+    }
+
+    // ------------------ Market Data Pipeline ------------------
+    // Decoding/aggregation runs on its own thread; the UI only reads published snapshots
+    NikTrade::MarketDataPipeline marketData(transport, bookticker_sub, bookticker_batch_sub, depth_sub, kline_sub, trade_sub, latency_sub, logger);
+
+    // ------------------ Kline Cache ------------------
+    // The chart starts from the candles earlier runs stored; the publisher is only asked
+    // for the ranges missing from it (see Chart Backfill below)
+    KlineCache klineCache(exeDir / "cache" / "klines");
+    KlineSeriesCache* chartCache = nullptr;
+    if (!chartSymbolName.empty()) {
+        chartCache = &klineCache.series(chartSymbolName, kTf1m);
+        std::vector<KlineData> cachedCandles = chartCache->read(chartHistoryRange());
+        marketData.seedKlines(cachedCandles);
+        marketData.attachKlineCache(*chartCache);
+        logger.logInfo(fmt::format("[INFO] {} cached candles for {}.", cachedCandles.size(), chartSymbolName));
+    }
+
+    if (nativeFeed) {
+        marketData.attachNativeFeed(*nativeFeed);
+        nativeFeed->start();
+    }
+    marketData.start();
+    logger.logInfo("Market data pipeline started.");
+
+    ZMQControlClient controlClient(transport.context(), "tcp://127.0.0.1:5560");
     logger.logInfo("ZMQ Control Client connected.");
 
     // ------------------ Storage ------------------
@@ -159,54 +276,105 @@ int main() {
     // THIS IS ACCESSED BY WINDOW ID
     std::vector<WindowBBO> activeBBOWindows; // Symbols currently being displayed in windows
     activeBBOWindows.reserve(50); // Reserve space for symbols being displayed (Max of 100 symbols)
-    activeBBOWindows.emplace_back(WindowBBO{true, 0, "", BBO{}}); // Start with window ID 0
-
-    // Hold various fb messages depending on symbol
-    std::unordered_map<std::string, std::vector<uint8_t>> latestFlatbufferMessages;
-    latestFlatbufferMessages.reserve(300); // just 300 symbols for now; NASDAQ Basic symbols not included
-
-    std::deque<std::vector<uint8_t>> latestKlineMessages;
-    std::deque<KlineData> klineDeque;
-
-    std::string latestLatencyMessage = "Latency: Loading...";
-
-    std::deque<std::string> currentSymbol;
-    if (!symbols.empty()) currentSymbol.push_back(symbols[0]);
-
-    static auto lastKlineRequest = std::chrono::steady_clock::now();
-    static const std::chrono::seconds requestInterval(5);
+    activeBBOWindows.emplace_back(WindowBBO{true, 0, kInvalidSymbolId, BBO{}}); // Start with window ID 0
+
+    // Bookticker/depth topics each window is subscribed to (window ID -> symbol)
+    std::unordered_map<int, SymbolId> windowSubscriptions;
+
+    // Depth books the pipeline wants a fresh snapshot for
+    std::vector<SymbolId> depthResyncs;
+
+    // Scratch for batched control requests (reused every frame)
+    std::vector<ControlOperation> controlOperations;
+    std::vector<ControlOutcome> controlOutcomes;
+
+    // Latest decoded market state published by the pipeline thread
+    std::shared_ptr<const NikTrade::MarketSnapshot> marketSnapshot = marketData.snapshot();
+
+    SymbolId chartSymbol = symbols.find(chartSymbolName);
+
+    // Chart candles: cached candles are already up. The live part is its own small batch,
+    // retried until the publisher accepts it: subscribe_klines backfills the newest gap in
+    // the cache (up to now) and then pushes kline updates, and the trade stream fills in
+    // between. The older gaps go out as a fire_klines batch that is posted, not waited for:
+    // its reply only comes once every REST page is downloaded, so it is polled each frame.
+    // One backfill is in flight at a time, and a failed one is retried for what is still
+    // missing by then, so no range is ever asked for while it is being downloaded.
+    bool chartStreamStarted = false;
+    uint64_t chartLiveFrom = 0; // Where subscribe_klines started downloading
+    auto lastChartRequest = std::chrono::steady_clock::now() - std::chrono::seconds(5);
+    static const std::chrono::seconds chartRetryInterval(5);
+    bool chartBackfillDone = false;
+    uint64_t chartBackfillBatch = 0; // Posted fire_klines batch still downloading, 0 = none
+    auto chartBackfillPosted = std::chrono::steady_clock::time_point{};
+    auto lastChartBackfill = std::chrono::steady_clock::now() - std::chrono::seconds(5);
+    static const std::chrono::minutes chartBackfillTimeout(2);
+
+    // Control requests are held back until the publisher reports its sockets are bound
+    // (window requests stay queued meanwhile); an external feed is assumed to be up
+    bool publisherReady = pythonLauncher == nullptr;
 
     // ------------------ Main Loop ------------------
     while (!glfwWindowShouldClose(window)) {
-        // Execute any pending symbol requests from windows
-        if (!pendingRRequests.empty()) {
+        // Grab the newest snapshot once per frame; everything below renders from it
+        marketSnapshot = marketData.snapshot();
+
+        if (!publisherReady) {
+            publisherReady = pythonLauncher->ready();
+            if (publisherReady) {
+                logger.logInfo(fmt::format("[INFO] Python publisher ready after {} ms.", pythonLauncher->sinceStart().count()));
+            } else if (pythonLauncher->sinceStart() > kPublisherReadyTimeout) {
+                publisherReady = true;
+                logger.logInfo("[WARN] No readiness message from the Python publisher; sending control requests anyway.");
+            }
+        }
+
+        // Execute any pending symbol requests from windows: one batched round-trip for all
+        // of them (restoring a whole layout included), then apply each per-item result
+        if (publisherReady && !pendingRRequests.empty()) {
+            controlOperations.clear();
             for (const SymbolRequest& req : pendingRRequests) {
-                std::string reply;
-                bool ok = controlClient.sendControlRequest(
-                    //fmt::format("start_symbol {}", req.requestedSymbol),
-                    fmt::format("{} {}", req.requestType, req.requestedSymbol),
-                    reply,
-                    logger,
-                    500
-                );
+                controlOperations.push_back({req.requestType, symbols.name(req.requestedSymbol)});
+            }
+            controlClient.sendControlBatch(controlOperations, controlOutcomes, logger, 500);
+
+            for (size_t i = 0; i < pendingRRequests.size(); ++i) {
+                const SymbolRequest& req = pendingRRequests[i];
+                bool ok = controlOutcomes[i].ok;
+
+                // Keep the SUB socket filter in sync with the set of open windows
+                auto subscription = windowSubscriptions.find(req.windowID);
+                if (subscription != windowSubscriptions.end() &&
+                    (req.requestType == "close_stream" || (ok && subscription->second != req.requestedSymbol))) {
+                    if (nativeFeed) nativeFeed->unsubscribe(subscription->second, Binance::kWsBookTicker);
+                    else transport.removeTopic(bookticker_sub, subscription->second);
+                    transport.removeTopic(depth_sub, subscription->second);
+                    windowSubscriptions.erase(subscription);
+                }
 
                 //BBO bbo = decodeToBBO(latestFlatbufferMessage, logger);
                 // handle activeWindows state
                 if (ok && req.requestType == "close_stream") {
-                    logger.logInfo(fmt::format("[INFO] Closing stream for symbol: {}", req.requestedSymbol));
+                    logger.logInfo(fmt::format("[INFO] Closing stream for symbol: {}", symbols.name(req.requestedSymbol)));
                     continue; // No need to update active windows for close requests
                 }
                 
                 if (ok) {
-                    logger.logInfo(fmt::format("[INFO] Start symbol: {}", req.requestedSymbol));
+                    logger.logInfo(fmt::format("[INFO] Start symbol: {}", symbols.name(req.requestedSymbol)));
+                    if (!windowSubscriptions.count(req.windowID)) {
+                        if (nativeFeed) nativeFeed->subscribe(req.requestedSymbol, Binance::kWsBookTicker);
+                        else transport.addTopic(bookticker_sub, req.requestedSymbol);
+                        transport.addTopic(depth_sub, req.requestedSymbol);
+                        windowSubscriptions[req.windowID] = req.requestedSymbol;
+                    }
                     activeBBOWindows[req.windowID] = WindowBBO{
                         true, 
                         req.windowID, 
                         req.requestedSymbol, 
-                        decodeToBBO(latestFlatbufferMessages[req.requestedSymbol], logger)}; // (verbose/unnecessary?)
+                        BBO{ .symbol = req.requestedSymbol, .error = "Waiting for live data...." }};
                 }
                 else {
-                    logger.logInfo("[WARN] Failed to execute requesst.");
+                    logger.logInfo(fmt::format("[WARN] Failed to execute requesst: {}", controlOutcomes[i].message));
                     activeBBOWindows[req.windowID] = WindowBBO{
                         true, 
                         req.windowID, 
@@ -222,6 +390,19 @@ int main() {
             pendingRRequests.clear();
         }
 
+        // Depth books that lost sync (or never got a snapshot) need a new one from the publisher.
+        // Not waited for: the reply only comes after the REST download, and the pipeline sees
+        // the snapshot arrive on the depth feed (and asks again if it does not).
+        depthResyncs.clear();
+        if (publisherReady) marketData.takeDepthResyncs(depthResyncs);
+        if (!depthResyncs.empty()) {
+            controlOperations.clear();
+            for (SymbolId symbol : depthResyncs) controlOperations.push_back({"depth_snapshot", symbols.name(symbol)});
+            if (!controlClient.postControlBatch(controlOperations, logger)) {
+                logger.logInfo(fmt::format("[WARN] Depth snapshot request for {} symbols could not be sent", depthResyncs.size()));
+            }
+        }
+
         startImGuiFrame(window);
 
         float bannerHeight = 90.0f; // CHANGE THIS IF BANNER HEIGHT CHANGES
@@ -242,90 +423,104 @@ int main() {
 
         int width, height; glfwGetWindowSize(window, &width, &height);
 
-        // ------------------ Handle BookTicker ------------------
-        // NOTE: Pair format:
-        // msg.first = topic (symbol name)
-        // msg.second = payload (flatbuffer data)
-        std::pair<std::string, std::vector<uint8_t>> msg;
-        if (bookticker_sub.pop(msg)) {
-            latestFlatbufferMessages[msg.first] = std::move(msg.second);
-        }
-        // Debug dump
-        /*
-        logger.logInfo("LatestFlatbufferMessages after pop:");
-        for (const auto& [symbol, buf] : latestFlatbufferMessages) {
-            logger.logInfo(fmt::format("Symbol: {}, Flatbuffer size: {}", symbol, buf.size()));
-        } */
-        // ------------------ Decode latest BBO for all windows (with failsafe) ------------------
+        // ------------------ Latest BBO for all windows (already decoded by the pipeline) ------------------
         for (auto& win : activeBBOWindows) {
             if (!win.active) continue;
 
-            // Construct the correct key with the prefix
-            std::string key = "bookticker." + win.desiredSymbol;
-            auto it = latestFlatbufferMessages.find(key);
+            auto it = marketSnapshot->latestBBOs->find(win.desiredSymbol);
 
-            if (it != latestFlatbufferMessages.end()) {
-                logger.logInfo(fmt::format("Decoding BBO for symbol: {}", win.desiredSymbol));
-                logger.logInfo(fmt::format("Flatbuffer size: {}", it->second.size()));
-                win.currentBBO = decodeToBBO(it->second, logger);
+            if (it != marketSnapshot->latestBBOs->end()) {
+                win.currentBBO = it->second;
             } else {
                 win.currentBBO.error = "Waiting for live data....";
             }
         }
 
-        // ------------------ Handle Latency ------------------
-        std::pair<std::string, std::vector<uint8_t>> latency_pair;
-        while (latency_sub.pop(latency_pair)) {
-            const std::vector<uint8_t>& latency_msg = latency_pair.second; // ignore topic
-            std::string str_msg(latency_msg.begin(), latency_msg.end());
-            auto space_pos = str_msg.find(' ');
-            if (space_pos != std::string::npos)
-                latestLatencyMessage = str_msg.substr(space_pos + 1);
-        }
-
 
-        // ------------------ Periodic Historical Klines ------------------
+        // ------------------ Chart Live Stream ------------------
         auto now = std::chrono::steady_clock::now();
-        if (!currentSymbol.empty() && now - lastKlineRequest >= requestInterval) {
-            lastKlineRequest = now;
-            std::string reply;
-            bool ok = controlClient.sendControlRequest(fmt::format("fire_klines {}", currentSymbol[0]), reply, logger, 1000);
-            if (!ok) logger.logInfo("[WARN] Historical klines request failed: " + reply);
+        bool chartReady = publisherReady && chartCache && symbols.contains(chartSymbol);
+        if (chartReady && !chartStreamStarted && now - lastChartRequest >= chartRetryInterval) {
+            lastChartRequest = now;
+            // Nothing is missing when the newest stored candle already reaches the current
+            // minute; the stream then starts right after it
+            std::vector<TimeRange> gaps = chartCache->missing(chartHistoryRange());
+            chartLiveFrom = gaps.empty() ? chartCache->newestOpen() + chartCache->intervalMs() : gaps.back().from;
+            if (nativeFeed) {
+                // Live klines/trades come from the native feed; the newest gap joins the backfill
+                nativeFeed->subscribe(chartSymbol, Binance::kWsKline1m | Binance::kWsTrade);
+                chartStreamStarted = true;
+            } else {
+                const std::string& chartName = symbols.name(chartSymbol);
+                controlOperations.clear();
+                controlOperations.push_back({"subscribe_klines", chartName, chartLiveFrom, 0});
+                controlOperations.push_back({"start_trades", chartName});
+
+                std::string reply;
+                bool ok = controlClient.sendControlBatch(controlOperations, controlOutcomes, logger, 1000);
+                for (const ControlOutcome& outcome : controlOutcomes) {
+                    if (!outcome.ok) {
+                        ok = false;
+                        reply = outcome.message;
+                        break;
+                    }
+                }
+                if (ok) chartStreamStarted = true;
+                else logger.logInfo("[WARN] Chart kline/trade subscription failed: " + reply);
+            }
         }
 
-        // ------------------ Read Kline Messages ------------------
-        std::pair<std::string, std::vector<uint8_t>> kline_pair;
-        while (kline_sub.pop(kline_pair)) {
-            const std::vector<uint8_t>& kline_msg = kline_pair.second; // ignore topic
-            const Binance::Klines* fb_klines = Binance::GetKlines(kline_msg.data());
-            if (!fb_klines || !fb_klines->klines()) continue;
-
-            for (auto kl : *(fb_klines->klines())) {
-                KlineData k;
-                k.open_time  = kl->open_time();
-                k.open       = std::stod(kl->open_price()->str());
-                k.high       = std::stod(kl->high_price()->str());
-                k.low        = std::stod(kl->low_price()->str());
-                k.close      = std::stod(kl->close_price()->str());
-                k.volume     = std::stod(kl->volume()->str());
-                k.close_time = kl->close_time();
-                klineDeque.push_back(k);
+        // ------------------ Chart Backfill ------------------
+        if (chartBackfillBatch) {
+            if (controlClient.pollBatchReply(chartBackfillBatch, controlOutcomes, logger)) {
+                chartBackfillBatch = 0;
+                auto failed = std::find_if(controlOutcomes.begin(), controlOutcomes.end(),
+                                           [](const ControlOutcome& outcome) { return !outcome.ok; });
+                if (failed == controlOutcomes.end()) chartBackfillDone = true;
+                else logger.logInfo("[WARN] Chart backfill failed, retrying what is still missing: " + failed->message);
+            } else if (now - chartBackfillPosted >= chartBackfillTimeout) {
+                controlClient.forgetBatch(chartBackfillBatch);
+                chartBackfillBatch = 0;
+                logger.logInfo("[WARN] Chart backfill got no answer in time, retrying what is still missing");
+            }
+        }
+        if (chartReady && chartStreamStarted && !chartBackfillDone && !chartBackfillBatch &&
+            now - lastChartBackfill >= chartRetryInterval) {
+            lastChartBackfill = now;
+            std::vector<TimeRange> gaps = chartCache->missing(chartHistoryRange());
+            if (nativeFeed) {
+                if (!gaps.empty()) gaps.back().to = 0; // Up to now; the feed only pushes candles from here on
+            } else {
+                // subscribe_klines downloads everything from chartLiveFrom on
+                std::erase_if(gaps, [&](const TimeRange& gap) { return gap.from >= chartLiveFrom; });
+                for (TimeRange& gap : gaps) gap.to = std::min(gap.to, chartLiveFrom - kTimeframeMs[kTf1m]);
             }
 
-            while (klineDeque.size() > 500) klineDeque.pop_front();
+            if (gaps.empty()) {
+                chartBackfillDone = true;
+            } else {
+                const std::string& chartName = symbols.name(chartSymbol);
+                controlOperations.clear();
+                for (const TimeRange& gap : gaps) controlOperations.push_back({"fire_klines", chartName, gap.from, gap.to});
+                chartBackfillBatch = controlClient.postControlBatch(controlOperations, logger, true);
+                chartBackfillPosted = now;
+                if (!chartBackfillBatch) logger.logInfo("[WARN] Chart backfill request could not be sent");
+            }
         }
 
         // ------------------ Render UI ------------------
         bool binanceConnected = true;
         bool zmqActive = true;
-        NikTrade::bannerWindow(binanceConnected, zmqActive, latestLatencyMessage, activeBBOWindows);
+        NikTrade::bannerWindow(binanceConnected, zmqActive, marketSnapshot->latencyMessage, activeBBOWindows);
         // dataDisplayWindow(window, width, height, tickDataVector); // TESTING PURPOSES
         // Orderbook windows
         for (auto& win : activeBBOWindows) {
             if (!win.active) continue;
-            orderBookDisplayWindow(window, width, height, symbols, logger, pendingRRequests, activeBBOWindows, win.windowID);
+            auto book = marketSnapshot->books->find(win.desiredSymbol);
+            const OrderBookView* orderBook = book != marketSnapshot->books->end() ? &book->second : nullptr;
+            orderBookDisplayWindow(window, width, height, symbolSearch, logger, pendingRRequests, activeBBOWindows, win.windowID, orderBook);
         }
-        chartDisplayWindow(window, width, height, klineDeque);
+        chartDisplayWindow(window, width, height, marketSnapshot->bars, marketSnapshot->barsVersion);
 
         int fbWidth, fbHeight;
         glfwGetFramebufferSize(window, &fbWidth, &fbHeight);
@@ -367,11 +562,11 @@ int main() {
     }
 
     // ------------------ Cleanup ------------------
-    bookticker_sub.stop();
-    kline_sub.stop();
-    latency_sub.stop();
+    marketData.stop();
+    if (nativeFeed) nativeFeed->stop();
+    transport.stop();
     if (pythonLauncher) pythonLauncher->stop();
-    forceClosePorts(logger);
+    if (!externalFeed) NikTrade::releasePorts(kFeedPorts, logger);
     shutdownUI(window);
 
     logger.logInfo("Application terminated cleanly.");
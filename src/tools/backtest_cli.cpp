@@ -0,0 +1,269 @@
+// niktrade_backtest: headless parameter sweeps over the backtest engines.
+//
+//   niktrade_backtest [options] <ticks.json>...
+//
+// Every (file, strategy, parameter set) combination becomes one job; jobs are spread
+// over a pool of worker threads and the results are written as CSV in job order.
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+#include <fmt/core.h>
+#include <nlohmann/json.hpp>
+
+#include "core/tick.hpp"
+#include "core/data_loader.hpp"
+#include "core/series_query.hpp"
+#include "core/backtest_engines/Trade.hpp"
+#include "core/backtest_engines/sma_crossover.hpp"
+#include "core/backtest_engines/macd_vwapBacktester.hpp"
+
+namespace {
+
+// Inclusive integer sweep "min:max:step" (a single number is a one-value range)
+struct ParamRange {
+    int min, max, step;
+
+    std::vector<int> values() const {
+        std::vector<int> out;
+        for (int v = min; v <= max; v += std::max(step, 1)) out.push_back(v);
+        return out;
+    }
+};
+
+enum class Strategy { SmaCrossover, MacdVwap };
+
+struct Options {
+    std::vector<std::string> files;
+    bool runSma = true;
+    bool runMacdVwap = true;
+    ParamRange smaFast{10, 10, 1};
+    ParamRange smaSlow{50, 50, 1};
+    ParamRange macdFast{12, 12, 1};
+    ParamRange macdSlow{26, 26, 1};
+    ParamRange macdSignal{9, 9, 1};
+    std::string from, to; // Tick date window; empty = unbounded
+    double capital = 50000;
+    unsigned threads = 0; // 0 = one per hardware thread
+    std::string outPath;  // empty = stdout
+};
+
+struct BacktestJob {
+    size_t file;
+    Strategy strategy;
+    int p1, p2, p3; // fast/slow for SMA; fast/slow/signal for MACD+VWAP
+};
+
+struct BacktestResult {
+    size_t buys = 0;
+    size_t sells = 0;
+    double realizedPnL = 0;
+    double unrealizedPnL = 0;
+    double maxDrawdown = 0; // Largest peak-to-trough drop of realized + unrealized PnL
+};
+
+void printUsage() {
+    std::fputs(
+        "usage: niktrade_backtest [options] <ticks.json>...\n"
+        "  --strategy sma|macd_vwap|all   strategies to run (default all)\n"
+        "  --sma-fast  MIN[:MAX[:STEP]]   fast SMA periods (default 10)\n"
+        "  --sma-slow  MIN[:MAX[:STEP]]   slow SMA periods (default 50)\n"
+        "  --macd-fast MIN[:MAX[:STEP]]   MACD fast EMA periods (default 12)\n"
+        "  --macd-slow MIN[:MAX[:STEP]]   MACD slow EMA periods (default 26)\n"
+        "  --macd-signal MIN[:MAX[:STEP]] MACD signal periods (default 9)\n"
+        "  --from DATE / --to DATE        only ticks dated in this window (ISO dates;\n"
+        "                                 --to 2024-03 includes all of March)\n"
+        "  --capital N                    starting capital (default 50000)\n"
+        "  --threads N                    worker threads (default: all cores)\n"
+        "  --out FILE                     write CSV here instead of stdout\n",
+        stderr);
+}
+
+bool parseRange(const std::string& text, ParamRange& range) {
+    int parts[3] = {0, 0, 1};
+    int count = std::sscanf(text.c_str(), "%d:%d:%d", &parts[0], &parts[1], &parts[2]);
+    if (count < 1) return false;
+    range.min = parts[0];
+    range.max = count >= 2 ? parts[1] : parts[0];
+    range.step = count >= 3 ? parts[2] : 1;
+    return range.min > 0 && range.max >= range.min && range.step > 0;
+}
+
+bool parseArgs(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto next = [&](std::string& value) {
+            if (i + 1 >= argc) return false;
+            value = argv[++i];
+            return true;
+        };
+
+        std::string value;
+        if (arg == "-h" || arg == "--help") {
+            return false;
+        } else if (arg == "--strategy") {
+            if (!next(value)) return false;
+            options.runSma = value == "sma" || value == "all";
+            options.runMacdVwap = value == "macd_vwap" || value == "all";
+            if (!options.runSma && !options.runMacdVwap) return false;
+        } else if (arg == "--sma-fast") {
+            if (!next(value) || !parseRange(value, options.smaFast)) return false;
+        } else if (arg == "--sma-slow") {
+            if (!next(value) || !parseRange(value, options.smaSlow)) return false;
+        } else if (arg == "--macd-fast") {
+            if (!next(value) || !parseRange(value, options.macdFast)) return false;
+        } else if (arg == "--macd-slow") {
+            if (!next(value) || !parseRange(value, options.macdSlow)) return false;
+        } else if (arg == "--macd-signal") {
+            if (!next(value) || !parseRange(value, options.macdSignal)) return false;
+        } else if (arg == "--from") {
+            if (!next(options.from)) return false;
+        } else if (arg == "--to") {
+            if (!next(options.to)) return false;
+        } else if (arg == "--capital") {
+            if (!next(value)) return false;
+            options.capital = std::stod(value);
+        } else if (arg == "--threads") {
+            if (!next(value)) return false;
+            options.threads = static_cast<unsigned>(std::stoul(value));
+        } else if (arg == "--out") {
+            if (!next(value)) return false;
+            options.outPath = value;
+        } else if (!arg.empty() && arg[0] == '-') {
+            return false;
+        } else {
+            options.files.push_back(arg);
+        }
+    }
+    return !options.files.empty();
+}
+
+std::vector<BacktestJob> buildJobs(const Options& options) {
+    std::vector<BacktestJob> jobs;
+    for (size_t file = 0; file < options.files.size(); ++file) {
+        if (options.runSma) {
+            for (int fast : options.smaFast.values())
+                for (int slow : options.smaSlow.values())
+                    if (fast < slow) jobs.push_back({file, Strategy::SmaCrossover, fast, slow, 0});
+        }
+        if (options.runMacdVwap) {
+            for (int fast : options.macdFast.values())
+                for (int slow : options.macdSlow.values())
+                    for (int signal : options.macdSignal.values())
+                        if (fast < slow) jobs.push_back({file, Strategy::MacdVwap, fast, slow, signal});
+        }
+    }
+    return jobs;
+}
+
+BacktestResult summarize(const std::vector<Trade>& trades) {
+    BacktestResult result;
+    double peak = 0;
+    for (const Trade& trade : trades) {
+        if (trade.order_type == "BUY") result.buys++;
+        else if (trade.order_type == "SELL") result.sells++;
+
+        double equity = trade.realizedPnL + trade.unrealizedPnL;
+        peak = std::max(peak, equity);
+        result.maxDrawdown = std::max(result.maxDrawdown, peak - equity);
+    }
+    if (!trades.empty()) {
+        result.realizedPnL = trades.back().realizedPnL;
+        result.unrealizedPnL = trades.back().unrealizedPnL;
+    }
+    return result;
+}
+
+// The engines take their parameters by non-const reference, so every worker gets its own
+// copy of those; the ticks are a read-only view shared by all of them
+BacktestResult runJob(const BacktestJob& job, std::span<const Tick> ticks, double capital) {
+    int p1 = job.p1, p2 = job.p2, p3 = job.p3;
+    switch (job.strategy) {
+        case Strategy::SmaCrossover:
+            return summarize(sma_crossover_result(p1, p2, capital, ticks));
+        case Strategy::MacdVwap:
+            return summarize(MACD_VWAPBacktestResultCalc(p1, p2, p3, capital, ticks));
+    }
+    return {};
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseArgs(argc, argv, options)) {
+        printUsage();
+        return 2;
+    }
+
+    // ------------------ Load data ------------------
+    std::vector<std::vector<Tick>> series(options.files.size());
+    std::vector<std::span<const Tick>> windows(options.files.size()); // --from/--to views into series
+    for (size_t i = 0; i < options.files.size(); ++i) {
+        std::ifstream file(options.files[i]);
+        if (!file.is_open()) {
+            fmt::print(stderr, "Failed to open {}\n", options.files[i]);
+            return 1;
+        }
+        try {
+            json jsonData; file >> jsonData;
+            series[i] = json_to_tickDataVector(jsonData);
+        } catch (const std::exception& e) {
+            fmt::print(stderr, "Failed to parse {}: {}\n", options.files[i], e.what());
+            return 1;
+        }
+        windows[i] = queryRange(series[i], options.from, options.to);
+        fmt::print(stderr, "Loaded {} ticks from {} ({} in range)\n", series[i].size(), options.files[i], windows[i].size());
+    }
+
+    // ------------------ Run jobs ------------------
+    std::vector<BacktestJob> jobs = buildJobs(options);
+    std::vector<BacktestResult> results(jobs.size());
+
+    unsigned threads = options.threads ? options.threads : std::max(1u, std::thread::hardware_concurrency());
+    threads = static_cast<unsigned>(std::min<size_t>(threads, std::max<size_t>(jobs.size(), 1)));
+    fmt::print(stderr, "Running {} backtests on {} threads\n", jobs.size(), threads);
+
+    auto start = std::chrono::steady_clock::now();
+    std::atomic<size_t> nextJob{0};
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    for (unsigned t = 0; t < threads; ++t) {
+        workers.emplace_back([&] {
+            for (size_t i = nextJob.fetch_add(1); i < jobs.size(); i = nextJob.fetch_add(1)) {
+                results[i] = runJob(jobs[i], windows[jobs[i].file], options.capital);
+            }
+        });
+    }
+    for (std::thread& worker : workers) worker.join();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    fmt::print(stderr, "Finished in {:.3f}s\n", seconds);
+
+    // ------------------ Write results ------------------
+    std::FILE* out = stdout;
+    if (!options.outPath.empty()) {
+        out = std::fopen(options.outPath.c_str(), "w");
+        if (!out) {
+            fmt::print(stderr, "Failed to open {} for writing\n", options.outPath);
+            return 1;
+        }
+    }
+
+    fmt::print(out, "file,strategy,fast,slow,signal,buys,sells,realized_pnl,unrealized_pnl,max_drawdown\n");
+    for (size_t i = 0; i < jobs.size(); ++i) {
+        const BacktestJob& job = jobs[i];
+        const BacktestResult& r = results[i];
+        bool sma = job.strategy == Strategy::SmaCrossover;
+        fmt::print(out, "{},{},{},{},{},{},{},{:.2f},{:.2f},{:.2f}\n",
+                   options.files[job.file], sma ? "sma_crossover" : "macd_vwap",
+                   job.p1, job.p2, sma ? "" : std::to_string(job.p3),
+                   r.buys, r.sells, r.realizedPnL, r.unrealizedPnL, r.maxDrawdown);
+    }
+    if (out != stdout) std::fclose(out);
+    return 0;
+}
@@ -0,0 +1,204 @@
+// niktrade_bench: microbenchmarks for the indicators, decoders and backtest engines.
+//
+// Google Benchmark flags apply, e.g. to record a baseline and compare against it:
+//   niktrade_bench --benchmark_out=baseline.json --benchmark_out_format=json
+//   niktrade_bench --benchmark_filter=Sma --benchmark_format=json
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "core/tick.hpp"
+#include "core/binance_kline.hpp"
+#include "core/BinanceBookTickerDecoder.hpp"
+#include "core/BinanceKlineDecoder.hpp"
+#include "core/symbol_registry.hpp"
+#include "core/series_archive.hpp"
+#include "core/tech_indicators/sma.hpp"
+#include "core/tech_indicators/ema.hpp"
+#include "core/tech_indicators/rsi.hpp"
+#include "core/tech_indicators/macd.hpp"
+#include "core/tech_indicators/vwap.hpp"
+#include "core/backtest_engines/sma_crossover.hpp"
+#include "core/backtest_engines/macd_vwapBacktester.hpp"
+#include "utils/file_logger.hpp"
+#include "tools/synthetic_feed.hpp"
+
+namespace {
+
+// Only one series is kept alive at a time: 10M ticks is close to a gigabyte, and
+// benchmarks run one size after another anyway
+std::vector<Tick>& ticksOfSize(size_t count) {
+    static std::vector<Tick> ticks;
+    if (ticks.size() != count) {
+        ticks.clear();
+        ticks.shrink_to_fit();
+        ticks = makeSyntheticTicks(count);
+    }
+    return ticks;
+}
+
+void indicatorSizes(benchmark::internal::Benchmark* b) {
+    b->RangeMultiplier(10)->Range(1'000, 10'000'000)->Unit(benchmark::kMicrosecond);
+}
+
+void backtestSizes(benchmark::internal::Benchmark* b) {
+    b->RangeMultiplier(10)->Range(1'000, 1'000'000)->Unit(benchmark::kMillisecond);
+}
+
+// ------------------ Indicators ------------------
+void BM_SmaCalc(benchmark::State& state) {
+    const std::vector<Tick>& ticks = ticksOfSize(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) benchmark::DoNotOptimize(smaCalc(50, ticks));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SmaCalc)->Apply(indicatorSizes);
+
+void BM_EmaCalc(benchmark::State& state) {
+    const std::vector<Tick>& ticks = ticksOfSize(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) benchmark::DoNotOptimize(emaCalc(50, ticks));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EmaCalc)->Apply(indicatorSizes);
+
+void BM_RsiCalc(benchmark::State& state) {
+    const std::vector<Tick>& ticks = ticksOfSize(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) benchmark::DoNotOptimize(rsiCalc(14, ticks));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RsiCalc)->Apply(indicatorSizes);
+
+void BM_MacdCalc(benchmark::State& state) {
+    const std::vector<Tick>& ticks = ticksOfSize(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) benchmark::DoNotOptimize(macdCalc(12, 26, 9, ticks));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_MacdCalc)->Apply(indicatorSizes);
+
+void BM_VwapCalc(benchmark::State& state) {
+    const std::vector<Tick>& ticks = ticksOfSize(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) benchmark::DoNotOptimize(vwapCalc(ticks));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_VwapCalc)->Apply(indicatorSizes);
+
+// ------------------ Decoders ------------------
+void BM_DecodeToBBO(benchmark::State& state) {
+    static FileLogger logger("niktrade_bench.log");
+    flatbuffers::FlatBufferBuilder builder(256);
+    encodeSyntheticBookTicker(builder, 1, "BTCUSDT", 64123.45, 1.25, 64123.46, 0.75);
+    std::vector<uint8_t> payload(builder.GetBufferPointer(), builder.GetBufferPointer() + builder.GetSize());
+
+    for (auto _ : state) benchmark::DoNotOptimize(decodeToBBO(payload, 0, logger));
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(payload.size()));
+}
+BENCHMARK(BM_DecodeToBBO);
+
+// Arg: quotes per batch frame; per-item time vs BM_DecodeToBBO is the batching gain
+void BM_DecodeBookTickerBatch(benchmark::State& state) {
+    const SymbolRegistry symbols({"btcusdt", "ethusdt", "solusdt", "xrpusdt"});
+    flatbuffers::FlatBufferBuilder builder(1024);
+    encodeSyntheticBookTickerBatch(builder, static_cast<size_t>(state.range(0)), 4, symbols.fingerprint());
+    std::vector<uint8_t> payload(builder.GetBufferPointer(), builder.GetBufferPointer() + builder.GetSize());
+
+    std::vector<BatchedQuote> out;
+    out.reserve(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        out.clear();
+        benchmark::DoNotOptimize(decodeBookTickerBatch(payload, symbols, out));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(payload.size()));
+}
+BENCHMARK(BM_DecodeBookTickerBatch)->Arg(1)->Arg(64)->Arg(256);
+
+// Arg: candles per Klines message (1 = live kline event, 500/1000 = REST backfill)
+void BM_DecodeKlines(benchmark::State& state) {
+    flatbuffers::FlatBufferBuilder builder(1024);
+    encodeSyntheticKlines(builder, makeSyntheticKlines(static_cast<size_t>(state.range(0)), 0, 60'000));
+    std::vector<uint8_t> payload(builder.GetBufferPointer(), builder.GetBufferPointer() + builder.GetSize());
+
+    std::vector<KlineData> out;
+    out.reserve(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        out.clear();
+        benchmark::DoNotOptimize(decodeToKlines(payload, out));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(payload.size()));
+}
+BENCHMARK(BM_DecodeKlines)->Arg(1)->Arg(500)->Arg(1000);
+
+// ------------------ Series archive ------------------
+// Arg: 1m candles in the archive
+std::filesystem::path benchArchive(size_t candles) {
+    std::filesystem::path path = std::filesystem::temp_directory_path() / ("niktrade_bench_" + std::to_string(candles) + ".nkta");
+    std::filesystem::remove(path);
+    SeriesArchiveWriter writer(ArchiveKind::Candles);
+    writer.open(path);
+    for (const KlineData& candle : makeSyntheticKlines(candles, 0, 60'000)) writer.append(candle);
+    return path;
+}
+
+void BM_ArchiveAppendCandles(benchmark::State& state) {
+    std::vector<KlineData> candles = makeSyntheticKlines(static_cast<size_t>(state.range(0)), 0, 60'000);
+    std::filesystem::path path = std::filesystem::temp_directory_path() / "niktrade_bench_append.nkta";
+    uint64_t bytes = 0;
+    for (auto _ : state) {
+        std::filesystem::remove(path);
+        SeriesArchiveWriter writer(ArchiveKind::Candles);
+        writer.open(path);
+        for (const KlineData& candle : candles) writer.append(candle);
+        writer.close();
+        bytes = writer.bytesWritten();
+    }
+    std::filesystem::remove(path);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["bytes_per_candle"] = static_cast<double>(bytes) / static_cast<double>(state.range(0));
+}
+BENCHMARK(BM_ArchiveAppendCandles)->Arg(100'000)->Arg(1'000'000)->Unit(benchmark::kMillisecond);
+
+// Bytes processed are the uncompressed KlineData equivalent
+void BM_ArchiveDecodeCandles(benchmark::State& state) {
+    std::filesystem::path path = benchArchive(static_cast<size_t>(state.range(0)));
+    SeriesArchiveReader reader;
+    reader.open(path);
+    CandleColumns columns;
+    columns.reserve(reader.rows());
+    for (auto _ : state) {
+        columns.clear();
+        benchmark::DoNotOptimize(reader.decode({0, UINT64_MAX}, columns));
+    }
+    std::filesystem::remove(path);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<int64_t>(sizeof(KlineData)));
+}
+BENCHMARK(BM_ArchiveDecodeCandles)->Arg(100'000)->Arg(1'000'000)->Unit(benchmark::kMillisecond);
+
+// ------------------ Backtests ------------------
+void BM_SmaCrossover(benchmark::State& state) {
+    std::vector<Tick>& ticks = ticksOfSize(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        int fast = 10, slow = 50;
+        double capital = 50000;
+        benchmark::DoNotOptimize(sma_crossover_result(fast, slow, capital, ticks));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SmaCrossover)->Apply(backtestSizes);
+
+void BM_MacdVwapBacktest(benchmark::State& state) {
+    std::vector<Tick>& ticks = ticksOfSize(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        int fast = 12, slow = 26, signal = 9;
+        benchmark::DoNotOptimize(MACD_VWAPBacktestResultCalc(fast, slow, signal, 50000, ticks));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_MacdVwapBacktest)->Apply(backtestSizes);
+
+} // namespace
+
+BENCHMARK_MAIN();
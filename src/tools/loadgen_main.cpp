@@ -0,0 +1,376 @@
+// niktrade_loadgen: synthetic stand-in for python/main.py plus a headless feed harness.
+//
+//   niktrade_loadgen [options]
+//
+// The publisher binds the same sockets as the Python feed (see used_ports.txt):
+//   5555 PUB  bookticker.<symbol>  Binance::BookTicker
+//   5556 PUB  klines.<symbol>      Binance::Klines (one live candle per message)
+//   5560 ROUTER control            "cmd symbol" -> "OK", ControlRequest -> all-Ok ControlReply
+//                                   (envelope and correlation id echoed)
+// BookTicker.update_id carries the publish time (ns since epoch) so the consumer can
+// measure publish-to-decode latency.
+//
+// --mode harness (default) also runs the C++ receive path in-process: ZMQTransport,
+// ZMQSubscriber queues and the FlatBuffers decoders, and reports msgs/s, queue depth,
+// drops and latency percentiles. --mode publish only publishes, for running the app
+// against it (start the app with NIKTRADE_EXTERNAL_FEED=1).
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <zmq.hpp>
+#include <fmt/core.h>
+#include <nlohmann/json.hpp>
+
+#include "core/BBO.hpp"
+#include "core/BinanceBookTickerDecoder.hpp"
+#include "core/BinanceKlineDecoder.hpp"
+#include "core/flatbuffers/Binance/binance_control_generated.h"
+#include "core/symbol_registry.hpp"
+#include "core/net/zmq_transport.hpp"
+#include "core/net/zmq_subscriber.hpp"
+#include "utils/file_logger.hpp"
+#include "tools/synthetic_feed.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+std::atomic<bool> g_stop{false};
+
+void onSignal(int) { g_stop.store(true); }
+
+uint64_t epochNanos() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+}
+
+struct Options {
+    bool harness = true;
+    double bookTickerRate = 100'000; // msgs/s across all symbols
+    double klineRate = 100;          // msgs/s across all symbols
+    size_t symbolCount = 100;
+    double durationSec = 10;         // 0 = until Ctrl-C
+    int sendHwm = 1000;              // libzmq default, same as the Python publisher
+    std::string symbolsFile;         // binance_symbols.json; synthetic names if empty
+};
+
+void printUsage() {
+    std::fputs(
+        "usage: niktrade_loadgen [options]\n"
+        "  --mode harness|publish   harness also consumes and reports (default harness)\n"
+        "  --rate N                 BookTicker msgs/s across all symbols (default 100000)\n"
+        "  --kline-rate N           Klines msgs/s across all symbols (default 100)\n"
+        "  --symbols N              number of symbols (default 100)\n"
+        "  --symbols-file FILE      take symbol names from binance_symbols.json\n"
+        "  --duration SEC           run time, 0 = until Ctrl-C (default 10)\n"
+        "  --hwm N                  PUB send high-water mark (default 1000)\n",
+        stderr);
+}
+
+bool parseArgs(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) return false;
+        std::string value = argv[++i];
+        try {
+            if (arg == "--mode") {
+                if (value != "harness" && value != "publish") return false;
+                options.harness = value == "harness";
+            }
+            else if (arg == "--rate") options.bookTickerRate = std::stod(value);
+            else if (arg == "--kline-rate") options.klineRate = std::stod(value);
+            else if (arg == "--symbols") options.symbolCount = std::stoul(value);
+            else if (arg == "--symbols-file") options.symbolsFile = value;
+            else if (arg == "--duration") options.durationSec = std::stod(value);
+            else if (arg == "--hwm") options.sendHwm = std::stoi(value);
+            else return false;
+        } catch (const std::exception&) {
+            return false;
+        }
+    }
+    return options.symbolCount > 0;
+}
+
+std::vector<std::string> loadSymbols(const Options& options) {
+    std::vector<std::string> names;
+    if (!options.symbolsFile.empty()) {
+        std::ifstream stream(options.symbolsFile);
+        if (stream.is_open()) {
+            nlohmann::json symbols; stream >> symbols;
+            for (const auto& symbol : symbols) {
+                if (names.size() == options.symbolCount) break;
+                names.push_back(symbol.get<std::string>());
+            }
+        } else {
+            fmt::print(stderr, "Failed to open {}; using synthetic symbols\n", options.symbolsFile);
+        }
+    }
+    for (size_t i = names.size(); i < options.symbolCount; ++i) names.push_back(fmt::format("sym{:05}usdt", i));
+    return names;
+}
+
+// ------------------ Publisher ------------------
+struct PublisherStats {
+    std::atomic<uint64_t> bookTickers{0};
+    std::atomic<uint64_t> klines{0};
+    std::atomic<uint64_t> controlRequests{0};
+};
+
+// PUB never blocks: above the HWM libzmq silently drops the message (as it does for the
+// Python publisher), so those losses only show up as published - received on the consumer
+void sendTopic(zmq::socket_t& socket, const std::string& topic, flatbuffers::FlatBufferBuilder& builder,
+               std::atomic<uint64_t>& sent)
+{
+    socket.send(zmq::message_t(topic.data(), topic.size()), zmq::send_flags::sndmore);
+    socket.send(zmq::message_t(builder.GetBufferPointer(), builder.GetSize()), zmq::send_flags::none);
+    sent.fetch_add(1, std::memory_order_relaxed);
+}
+
+// Whole multipart message, or false if none is waiting
+bool recvMultipart(zmq::socket_t& socket, std::vector<zmq::message_t>& frames)
+{
+    frames.clear();
+    zmq::message_t frame;
+    if (!socket.recv(frame, zmq::recv_flags::dontwait)) return false;
+    bool more = frame.more();
+    frames.push_back(std::move(frame));
+    while (more) {
+        zmq::message_t next;
+        if (!socket.recv(next, zmq::recv_flags::none)) break;
+        more = next.more();
+        frames.push_back(std::move(next));
+    }
+    return true;
+}
+
+// What the Python feed answers to a batched ControlRequest when every item succeeds
+std::string replyToControlBatch(const zmq::message_t& request)
+{
+    const auto* data = static_cast<const uint8_t*>(request.data());
+    flatbuffers::Verifier verifier(data, request.size());
+    if (!Binance::VerifyControlRequestBuffer(verifier)) return "ERROR: malformed control batch";
+
+    const Binance::ControlRequest* batch = Binance::GetControlRequest(data);
+    size_t count = batch->items() ? batch->items()->size() : 0;
+    flatbuffers::FlatBufferBuilder builder(64 + 16 * count);
+    std::vector<flatbuffers::Offset<Binance::ControlResult>> results(count);
+    for (auto& result : results) result = Binance::CreateControlResult(builder, Binance::ControlStatus_Ok);
+    builder.Finish(Binance::CreateControlReplyDirect(builder, batch->request_id(), &results), Binance::ControlRequestIdentifier());
+    return std::string(reinterpret_cast<const char*>(builder.GetBufferPointer()), builder.GetSize());
+}
+
+void runPublisher(zmq::context_t& context, const Options& options, const std::vector<std::string>& symbols,
+                  PublisherStats& stats)
+{
+    zmq::socket_t bookTickerPub(context, ZMQ_PUB);
+    zmq::socket_t klinePub(context, ZMQ_PUB);
+    zmq::socket_t control(context, ZMQ_ROUTER);
+    bookTickerPub.set(zmq::sockopt::sndhwm, options.sendHwm);
+    klinePub.set(zmq::sockopt::sndhwm, options.sendHwm);
+    bookTickerPub.bind("tcp://127.0.0.1:5555");
+    klinePub.bind("tcp://127.0.0.1:5556");
+    control.bind("tcp://127.0.0.1:5560");
+
+    std::vector<std::string> bookTickerTopics, klineTopics;
+    for (const std::string& symbol : symbols) {
+        bookTickerTopics.push_back("bookticker." + symbol);
+        klineTopics.push_back("klines." + symbol);
+    }
+
+    std::vector<KlineData> candle = makeSyntheticKlines(1, 0, 60'000);
+    std::vector<double> mids(symbols.size(), 100.0);
+    flatbuffers::FlatBufferBuilder builder(512);
+
+    uint64_t bookTickersDue = 0, klinesDue = 0;
+    size_t nextBookTicker = 0, nextKline = 0;
+    const auto start = Clock::now();
+
+    while (!g_stop.load(std::memory_order_relaxed)) {
+        // Control requests are answered like the Python feed would, without side effects;
+        // everything before the request frame (identity, delimiter, correlation id) is echoed
+        std::vector<zmq::message_t> request;
+        while (recvMultipart(control, request)) {
+            stats.controlRequests.fetch_add(1, std::memory_order_relaxed);
+            std::string reply;
+            if (request.back().size() >= 8 && Binance::ControlRequestBufferHasIdentifier(request.back().data())) {
+                reply = replyToControlBatch(request.back());
+            } else {
+                bool valid = request.back().to_string().find(' ') != std::string::npos;
+                reply = valid ? "OK" : "ERROR: invalid format";
+            }
+            for (size_t i = 0; i + 1 < request.size(); ++i) control.send(request[i], zmq::send_flags::sndmore);
+            control.send(zmq::message_t(reply.data(), reply.size()), zmq::send_flags::none);
+        }
+
+        // Pace by elapsed time so the average rate holds even when a batch runs late
+        double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+        uint64_t bookTickerTarget = static_cast<uint64_t>(elapsed * options.bookTickerRate);
+        uint64_t klineTarget = static_cast<uint64_t>(elapsed * options.klineRate);
+
+        for (; bookTickersDue < bookTickerTarget; ++bookTickersDue) {
+            size_t i = nextBookTicker++ % symbols.size();
+            double& mid = mids[i];
+            mid *= (bookTickersDue & 1) ? 1.0001 : 0.9999;
+            encodeSyntheticBookTicker(builder, epochNanos(), symbols[i], mid - 0.01, 1.5, mid + 0.01, 2.5);
+            sendTopic(bookTickerPub, bookTickerTopics[i], builder, stats.bookTickers);
+        }
+        for (; klinesDue < klineTarget; ++klinesDue) {
+            size_t i = nextKline++ % symbols.size();
+            candle[0].open_time = epochNanos() / 1'000'000 / 60'000 * 60'000;
+            candle[0].close_time = candle[0].open_time + 59'999;
+            candle[0].close = mids[i];
+            encodeSyntheticKlines(builder, candle);
+            sendTopic(klinePub, klineTopics[i], builder, stats.klines);
+        }
+
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+}
+
+// ------------------ Harness ------------------
+// 1 us buckets up to 100 ms; anything slower lands in the last bucket
+class LatencyHistogram {
+public:
+    void add(uint64_t nanos) {
+        size_t bucket = std::min<size_t>(nanos / 1000, counts_.size() - 1);
+        counts_[bucket]++;
+        total_++;
+        max_ = std::max(max_, nanos);
+    }
+
+    // Upper edge of the bucket holding the q-th sample, in microseconds
+    double percentileMicros(double q) const {
+        if (total_ == 0) return 0;
+        uint64_t rank = static_cast<uint64_t>(q * static_cast<double>(total_ - 1)) + 1;
+        uint64_t seen = 0;
+        for (size_t i = 0; i < counts_.size(); ++i) {
+            seen += counts_[i];
+            if (seen >= rank) return static_cast<double>(i + 1);
+        }
+        return static_cast<double>(counts_.size());
+    }
+
+    uint64_t total() const { return total_; }
+    double maxMicros() const { return static_cast<double>(max_) / 1000.0; }
+
+private:
+    std::vector<uint64_t> counts_ = std::vector<uint64_t>(100'000, 0);
+    uint64_t total_ = 0;
+    uint64_t max_ = 0;
+};
+
+// Published messages that never reached the queue (includes in-flight ones mid-run)
+uint64_t lostInTransport(uint64_t published, uint64_t consumed, const Binance::ZMQSubscriber& queue) {
+    uint64_t accounted = consumed + queue.dropped();
+    return published > accounted ? published - accounted : 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseArgs(argc, argv, options)) {
+        printUsage();
+        return 2;
+    }
+    std::signal(SIGINT, onSignal);
+    std::signal(SIGTERM, onSignal);
+
+    std::vector<std::string> symbolNames = loadSymbols(options);
+    fmt::print(stderr, "Publishing {:.0f} BookTicker/s and {:.0f} Klines/s over {} symbols\n",
+               options.bookTickerRate, options.klineRate, symbolNames.size());
+
+    zmq::context_t publisherContext(1);
+    PublisherStats published;
+    std::thread publisher([&] { runPublisher(publisherContext, options, symbolNames, published); });
+
+    if (!options.harness) {
+        auto deadline = Clock::now() + std::chrono::duration<double>(options.durationSec);
+        while (!g_stop.load() && (options.durationSec <= 0 || Clock::now() < deadline)) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+        g_stop.store(true);
+        publisher.join();
+        fmt::print(stderr, "Published {} BookTicker, {} Klines; {} control requests\n",
+                   published.bookTickers.load(), published.klines.load(), published.controlRequests.load());
+        return 0;
+    }
+
+    // Same routes and queue sizes as the app (main.cpp), but every symbol is wanted
+    FileLogger logger("niktrade_loadgen.log");
+    const SymbolRegistry symbols(symbolNames);
+    Binance::ZMQTransport transport(symbols);
+    Binance::ZMQSubscriber& bookTickerSub = transport.subscribe("tcp://127.0.0.1:5555", "bookticker.", 524288);
+    Binance::ZMQSubscriber& klineSub = transport.subscribe("tcp://127.0.0.1:5556", "klines.", 262144);
+    transport.start();
+
+    LatencyHistogram latency;
+    uint64_t decodedBookTickers = 0, decodedKlines = 0, decodeErrors = 0;
+    uint64_t lastBookTickers = 0, lastPublished = 0;
+    size_t maxQueueDepth = 0;
+    Binance::FeedMessage message;
+    std::vector<KlineData> klines;
+
+    fmt::print(stderr, "{:>6} {:>12} {:>12} {:>10} {:>10} {:>10} {:>9} {:>9}\n",
+               "t(s)", "pub/s", "decoded/s", "queue", "q.drops", "lost", "p50(us)", "p99(us)");
+
+    const auto start = Clock::now();
+    auto nextReport = start + std::chrono::seconds(1);
+    while (!g_stop.load(std::memory_order_relaxed)) {
+        transport.waitForData(std::chrono::milliseconds(10));
+
+        maxQueueDepth = std::max(maxQueueDepth, bookTickerSub.queued());
+        while (bookTickerSub.pop(message)) {
+            BBO bbo = decodeToBBO(message.payload, message.symbolId, logger);
+            if (!bbo.error.empty()) { decodeErrors++; continue; }
+            uint64_t sentAt = Binance::GetBookTicker(message.payload.data())->update_id();
+            uint64_t now = epochNanos();
+            latency.add(now > sentAt ? now - sentAt : 0);
+            decodedBookTickers++;
+        }
+        while (klineSub.pop(message)) {
+            klines.clear();
+            if (decodeToKlines(message.payload, klines) == 0) decodeErrors++;
+            else decodedKlines++;
+        }
+
+        auto now = Clock::now();
+        if (now >= nextReport) {
+            double t = std::chrono::duration<double>(now - start).count();
+            uint64_t pub = published.bookTickers.load();
+            fmt::print(stderr, "{:>6.1f} {:>12} {:>12} {:>10} {:>10} {:>10} {:>9.0f} {:>9.0f}\n",
+                       t, pub - lastPublished, decodedBookTickers - lastBookTickers, maxQueueDepth,
+                       bookTickerSub.dropped(), lostInTransport(pub, decodedBookTickers + decodeErrors, bookTickerSub),
+                       latency.percentileMicros(0.50), latency.percentileMicros(0.99));
+            lastPublished = pub;
+            lastBookTickers = decodedBookTickers;
+            maxQueueDepth = 0;
+            nextReport += std::chrono::seconds(1);
+            if (options.durationSec > 0 && t >= options.durationSec) break;
+        }
+    }
+
+    g_stop.store(true);
+    publisher.join();
+    transport.stop();
+
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    uint64_t publishedTotal = published.bookTickers.load();
+    uint64_t lost = lostInTransport(publishedTotal, decodedBookTickers + decodeErrors, bookTickerSub);
+    fmt::print("\n------------------ Feed harness ------------------\n");
+    fmt::print("BookTicker published   {} ({:.0f}/s)\n", publishedTotal, publishedTotal / seconds);
+    fmt::print("BookTicker decoded     {} ({:.0f}/s)\n", decodedBookTickers, decodedBookTickers / seconds);
+    fmt::print("Klines decoded         {} of {}\n", decodedKlines, published.klines.load());
+    fmt::print("Dropped at full queue  {} bookticker, {} klines\n", bookTickerSub.dropped(), klineSub.dropped());
+    fmt::print("Lost before the queue  {} (PUB/SUB high-water marks)\n", lost);
+    fmt::print("Decode errors          {}\n", decodeErrors);
+    fmt::print("Publish->decode (us)   p50 {:.0f}  p90 {:.0f}  p99 {:.0f}  p99.9 {:.0f}  max {:.0f}\n",
+               latency.percentileMicros(0.50), latency.percentileMicros(0.90), latency.percentileMicros(0.99),
+               latency.percentileMicros(0.999), latency.maxMicros());
+    return 0;
+}
@@ -0,0 +1,108 @@
+#include "synthetic_feed.hpp"
+#include <algorithm>
+#include <random>
+#include <fmt/format.h>
+#include "core/flatbuffers/Binance/binance_bookticker_generated.h"
+#include "core/flatbuffers/Binance/binance_bookticker_batch_generated.h"
+#include "core/flatbuffers/Binance/binance_kline_generated.h"
+
+namespace {
+
+// Random walk with ~1% moves; never drops below 1
+struct PriceWalk {
+    std::mt19937_64 rng;
+    std::normal_distribution<double> move{0.0, 0.01};
+    double price = 100.0;
+
+    explicit PriceWalk(uint64_t seed) : rng(seed) {}
+
+    double next() {
+        price = std::max(1.0, price * (1.0 + move(rng)));
+        return price;
+    }
+};
+
+flatbuffers::Offset<flatbuffers::String> priceString(flatbuffers::FlatBufferBuilder& builder, double value) {
+    char buf[32];
+    auto end = fmt::format_to_n(buf, sizeof(buf), "{:.8f}", value).out;
+    return builder.CreateString(buf, static_cast<size_t>(end - buf));
+}
+
+} // namespace
+
+std::vector<Tick> makeSyntheticTicks(size_t count, uint64_t seed) {
+    PriceWalk walk(seed);
+    std::vector<Tick> ticks(count);
+    for (size_t i = 0; i < count; ++i) {
+        Tick& t = ticks[i];
+        t.date = fmt::format("d{}", i);
+        t.open = walk.price;
+        t.close = walk.next();
+        t.high = std::max(t.open, t.close) * 1.005;
+        t.low = std::min(t.open, t.close) * 0.995;
+        t.volume = 1000 + static_cast<int>(walk.rng() % 9000);
+    }
+    return ticks;
+}
+
+std::vector<KlineData> makeSyntheticKlines(size_t count, uint64_t startMs, uint64_t intervalMs, uint64_t seed) {
+    PriceWalk walk(seed);
+    std::vector<KlineData> klines(count);
+    for (size_t i = 0; i < count; ++i) {
+        KlineData& k = klines[i];
+        k.open_time = startMs + i * intervalMs;
+        k.close_time = k.open_time + intervalMs - 1;
+        k.open = walk.price;
+        k.close = walk.next();
+        k.high = std::max(k.open, k.close) * 1.001;
+        k.low = std::min(k.open, k.close) * 0.999;
+        k.volume = static_cast<double>(walk.rng() % 10000) / 100.0;
+    }
+    return klines;
+}
+
+void encodeSyntheticBookTicker(flatbuffers::FlatBufferBuilder& builder,
+                               uint64_t updateId,
+                               const std::string& symbol,
+                               double bid, double bidQty,
+                               double ask, double askQty)
+{
+    builder.Clear();
+    auto symbolOffset = builder.CreateString(symbol);
+    auto bidOffset = priceString(builder, bid);
+    auto bidQtyOffset = priceString(builder, bidQty);
+    auto askOffset = priceString(builder, ask);
+    auto askQtyOffset = priceString(builder, askQty);
+    builder.Finish(Binance::CreateBookTicker(builder, updateId, symbolOffset,
+                                             bidOffset, bidQtyOffset, askOffset, askQtyOffset));
+}
+
+void encodeSyntheticBookTickerBatch(flatbuffers::FlatBufferBuilder& builder,
+                                    size_t count, uint32_t symbolCount, uint64_t registryHash)
+{
+    builder.Clear();
+    std::vector<Binance::Quote> quotes;
+    quotes.reserve(count);
+    double mid = 64123.45;
+    for (size_t i = 0; i < count; ++i) {
+        mid += (i % 2 ? 0.01 : -0.01);
+        quotes.emplace_back(static_cast<uint32_t>(i % std::max<uint32_t>(symbolCount, 1)), i + 1, i * 1000,
+                            mid - 0.005, 1.25, mid + 0.005, 0.75);
+    }
+    builder.Finish(Binance::CreateBookTickerBatchDirect(builder, &quotes, count * 1000, registryHash));
+}
+
+void encodeSyntheticKlines(flatbuffers::FlatBufferBuilder& builder, const std::vector<KlineData>& klines) {
+    builder.Clear();
+    std::vector<flatbuffers::Offset<Binance::Kline>> offsets;
+    offsets.reserve(klines.size());
+    for (const KlineData& k : klines) {
+        auto open = priceString(builder, k.open);
+        auto high = priceString(builder, k.high);
+        auto low = priceString(builder, k.low);
+        auto close = priceString(builder, k.close);
+        auto volume = priceString(builder, k.volume);
+        offsets.push_back(Binance::CreateKline(builder, k.open_time, open, high, low, close, volume, k.close_time));
+    }
+    builder.Finish(Binance::CreateKlines(builder, builder.CreateVector(offsets)));
+}
@@ -0,0 +1,33 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <flatbuffers/flatbuffers.h>
+#include "core/tick.hpp"
+#include "core/binance_kline.hpp"
+
+// Deterministic synthetic market data for the benchmark and load-generator tools.
+// Prices follow a seeded random walk so runs are repeatable.
+
+// Daily-style ticks (dates are "d<index>")
+std::vector<Tick> makeSyntheticTicks(size_t count, uint64_t seed = 42);
+
+// Contiguous candles starting at `startMs`
+std::vector<KlineData> makeSyntheticKlines(size_t count, uint64_t startMs, uint64_t intervalMs, uint64_t seed = 42);
+
+// Encode one Binance::BookTicker into `builder` (cleared first); prices are
+// written as decimal strings like the Python encoder does
+void encodeSyntheticBookTicker(flatbuffers::FlatBufferBuilder& builder,
+                               uint64_t updateId,
+                               const std::string& symbol,
+                               double bid, double bidQty,
+                               double ask, double askQty);
+
+// Encode a Binance::BookTickerBatch of `count` quotes cycling over the first
+// `symbolCount` ids, stamped with `registryHash` (SymbolRegistry::fingerprint)
+void encodeSyntheticBookTickerBatch(flatbuffers::FlatBufferBuilder& builder,
+                                    size_t count, uint32_t symbolCount, uint64_t registryHash);
+
+// Encode a Binance::Klines message holding `klines` into `builder` (cleared first)
+void encodeSyntheticKlines(flatbuffers::FlatBufferBuilder& builder, const std::vector<KlineData>& klines);
@@ -0,0 +1,103 @@
+#include "virtual_table.hpp"
+#include <algorithm>
+#include <numeric>
+
+VirtualTable::VirtualTable(std::vector<VirtualTableColumn> columns)
+    : columns_(std::move(columns))
+{
+}
+
+void VirtualTable::invalidate() {
+    invalidated_ = true;
+}
+
+void VirtualTable::sortRows(size_t rowCount, const CompareRows& compare) {
+    order_.resize(rowCount);
+    std::iota(order_.begin(), order_.end(), size_t{0});
+    size_t column = static_cast<size_t>(sortColumn_);
+    if (sortDescending_) {
+        std::stable_sort(order_.begin(), order_.end(),
+                         [&](size_t a, size_t b) { return compare(b, a, column); });
+    } else {
+        std::stable_sort(order_.begin(), order_.end(),
+                         [&](size_t a, size_t b) { return compare(a, b, column); });
+    }
+}
+
+void VirtualTable::draw(const char* id,
+                        size_t rowCount,
+                        uint64_t dataVersion,
+                        const FormatCell& format,
+                        const CompareRows& compare,
+                        const ImVec2& size)
+{
+    const size_t columnCount = columns_.size();
+    // A new generation makes every cached row stale without touching the rows
+    if (invalidated_ || dataVersion != dataVersion_) {
+        generation_++;
+        dataVersion_ = dataVersion;
+        invalidated_ = false;
+    }
+    if (rowGeneration_.size() != rowCount) {
+        rowGeneration_.resize(rowCount, 0);
+        cells_.resize(rowCount * columnCount);
+    }
+
+    ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg |
+                            ImGuiTableFlags_ScrollY | ImGuiTableFlags_Resizable;
+    if (compare) flags |= ImGuiTableFlags_Sortable | ImGuiTableFlags_SortTristate;
+
+    if (!ImGui::BeginTable(id, static_cast<int>(columnCount), flags, size)) return;
+
+    ImGui::TableSetupScrollFreeze(0, 1);
+    for (const VirtualTableColumn& column : columns_) {
+        ImGuiTableColumnFlags columnFlags = column.width > 0.0f ? ImGuiTableColumnFlags_WidthFixed
+                                                                 : ImGuiTableColumnFlags_WidthStretch;
+        ImGui::TableSetupColumn(column.label, columnFlags, column.width);
+    }
+    ImGui::TableHeadersRow();
+
+    // Re-sort only when the sort spec or the data changed
+    if (compare) {
+        if (ImGuiTableSortSpecs* specs = ImGui::TableGetSortSpecs()) {
+            if (specs->SpecsDirty) {
+                sortColumn_ = specs->SpecsCount > 0 ? specs->Specs[0].ColumnIndex : -1;
+                sortDescending_ = specs->SpecsCount > 0 &&
+                                  specs->Specs[0].SortDirection == ImGuiSortDirection_Descending;
+                specs->SpecsDirty = false;
+                sortedGeneration_ = 0;
+            }
+        }
+    }
+    if (sortColumn_ < 0 || !compare) {
+        order_.clear();
+    } else if (sortedGeneration_ != generation_ || order_.size() != rowCount) {
+        sortRows(rowCount, compare);
+        sortedGeneration_ = generation_;
+    }
+
+    ImGuiListClipper clipper;
+    clipper.Begin(static_cast<int>(rowCount));
+    while (clipper.Step()) {
+        for (int display = clipper.DisplayStart; display < clipper.DisplayEnd; ++display) {
+            size_t row = order_.empty() ? static_cast<size_t>(display) : order_[display];
+            std::string* cells = &cells_[row * columnCount];
+
+            if (rowGeneration_[row] != generation_) {
+                for (size_t column = 0; column < columnCount; ++column) {
+                    cells[column].clear();
+                    format(row, column, cells[column]);
+                }
+                rowGeneration_[row] = generation_;
+            }
+
+            ImGui::TableNextRow();
+            for (size_t column = 0; column < columnCount; ++column) {
+                ImGui::TableSetColumnIndex(static_cast<int>(column));
+                ImGui::TextUnformatted(cells[column].data(), cells[column].data() + cells[column].size());
+            }
+        }
+    }
+
+    ImGui::EndTable();
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+#include <imgui.h>
+
+// Column of a VirtualTable; a width of 0 stretches the column
+struct VirtualTableColumn {
+    const char* label;
+    float width = 0.0f;
+};
+
+// Scrolling table that only formats and submits the rows on screen.
+//
+// Cell text is cached per row and reformatted only when the caller's data version
+// moves past the version the row was formatted at, so a table that does not change
+// costs no formatting at all. Sorting reorders an index permutation; the rows
+// themselves are never copied or moved.
+class VirtualTable {
+public:
+    // Append the text for (row, column) to `out` (cleared before the call)
+    using FormatCell = std::function<void(size_t row, size_t column, std::string& out)>;
+    // Strict weak ordering of two rows on one column (ascending)
+    using CompareRows = std::function<bool(size_t a, size_t b, size_t column)>;
+
+    explicit VirtualTable(std::vector<VirtualTableColumn> columns);
+
+    // Draw `rowCount` rows. `dataVersion` must change whenever row contents may have
+    // changed. Columns are sortable when `compare` is set.
+    void draw(const char* id,
+              size_t rowCount,
+              uint64_t dataVersion,
+              const FormatCell& format,
+              const CompareRows& compare = nullptr,
+              const ImVec2& size = ImVec2(0, 200));
+
+    // Forget every cached row, e.g. when the same table starts showing other data
+    void invalidate();
+
+private:
+    void sortRows(size_t rowCount, const CompareRows& compare);
+
+    std::vector<VirtualTableColumn> columns_;
+    std::vector<std::string> cells_;    // rowCount * columns, row-major
+    std::vector<uint64_t> rowGeneration_; // Generation each row was formatted at (0 = never)
+    uint64_t generation_ = 0;             // Bumped whenever the data version changes
+    uint64_t dataVersion_ = 0;
+    bool invalidated_ = true;
+
+    std::vector<size_t> order_;         // Display position -> row; empty while unsorted
+    int sortColumn_ = -1;
+    bool sortDescending_ = false;
+    uint64_t sortedGeneration_ = 0;
+};
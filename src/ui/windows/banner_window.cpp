@@ -6,7 +6,7 @@ namespace NikTrade {
 void bannerWindow(
     bool& binanceConnected, 
     bool& zmqActive, 
-    std::string& latency_message,
+    const std::string& latency_message,
     std::vector<WindowBBO>& activeBBOWindows
 ) {
     ImGuiIO& io = ImGui::GetIO();
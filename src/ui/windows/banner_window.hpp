@@ -9,7 +9,7 @@ namespace NikTrade {
     void bannerWindow(
         bool& binanceConnected, 
         bool& zmqActive, 
-        std::string& latencyMs,
+        const std::string& latencyMs,
         std::vector<WindowBBO>& activeBBOWindows
     );
 }
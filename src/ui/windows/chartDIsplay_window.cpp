@@ -5,12 +5,52 @@
 #include <vector>
 #include <deque>
 #include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <fmt/format.h>
+#include "ui/widgets/virtual_table.hpp"
+
+namespace {
+
+constexpr double kCandleHalfWidth = 0.35;
+// Below this many pixels per candle, candles are merged per pixel column
+constexpr double kMinPixelsPerCandle = 3.0;
+
+// Plot coordinates are converted as doubles; large x/price values lose precision in float
+void drawCandle(ImDrawList* drawList, double x, double halfWidth,
+                double open, double high, double low, double close, bool outline)
+{
+    ImU32 color = (close > open) ? IM_COL32(0, 255, 0, 255) :
+                  (close < open) ? IM_COL32(255, 0, 0, 255) :
+                                   IM_COL32(180, 180, 180, 255);
+
+    ImVec2 pHigh  = ImPlot::PlotToPixels(x, high);
+    ImVec2 pLow   = ImPlot::PlotToPixels(x, low);
+    ImVec2 pOpen  = ImPlot::PlotToPixels(x - halfWidth, open);
+    ImVec2 pClose = ImPlot::PlotToPixels(x + halfWidth, close);
+
+    drawList->AddLine(pHigh, pLow, color, 1.5f);
+    drawList->AddRectFilled(pOpen, pClose, color);
+    if (outline) drawList->AddRect(pOpen, pClose, IM_COL32(0, 0, 0, 255), 0.0f, 0, 1.0f);
+}
+
+} // namespace
 
 void chartDisplayWindow(GLFWwindow* window, int windowWidth, int windowHeight,
-    const std::deque<KlineData>& klines)
+    const std::array<BarSeries, kTimeframeCount>& barsByTimeframe,
+    const std::array<uint64_t, kTimeframeCount>& barsVersion)
 {
     ImGui::Begin("Chart Display");
 
+    // Every timeframe is already resampled; switching only picks another series
+    static int selectedTimeframe = kTf1m;
+    bool timeframeChanged = false;
+    for (int tf = 0; tf < static_cast<int>(kTimeframeCount); ++tf) {
+        if (tf > 0) ImGui::SameLine();
+        timeframeChanged |= ImGui::RadioButton(kTimeframeNames[tf], &selectedTimeframe, tf);
+    }
+    const BarSeries& klines = barsByTimeframe[selectedTimeframe];
+
     if (klines.empty()) {
         ImGui::Text("No candles available.");
         ImGui::BeginChild("CandleScroll", ImVec2(0, 200), true);
@@ -20,18 +60,42 @@ void chartDisplayWindow(GLFWwindow* window, int windowWidth, int windowHeight,
         return;
     }
 
-    // Raw data display
+    // Raw data display; only visible rows are formatted, and only after the bars change
+    static VirtualTable candleTable({
+        {"OpenTime", 120.0f}, {"Open"}, {"High"}, {"Low"}, {"Close"}, {"Volume"}, {"CloseTime", 120.0f}
+    });
+    if (timeframeChanged) candleTable.invalidate();
+
     if (ImGui::CollapsingHeader("Raw Candle Data")) {
-        ImGui::BeginChild("CandleScroll", ImVec2(0, 200), true);
-        for (const auto& k : klines) {
-            ImGui::Text("OpenTime: %" PRIu64 " | O: %.2f H: %.2f L: %.2f C: %.2f V: %.2f | CloseTime: %" PRIu64,
-                        k.open_time, k.open, k.high, k.low, k.close, k.volume, k.close_time);
-        }
-        ImGui::EndChild();
+        candleTable.draw("CandleTable", klines.size(), barsVersion[selectedTimeframe],
+            [&](size_t row, size_t column, std::string& out) {
+                const KlineData& k = klines[row];
+                auto it = std::back_inserter(out);
+                switch (column) {
+                    case 0: fmt::format_to(it, "{}", k.open_time); break;
+                    case 1: fmt::format_to(it, "{:.2f}", k.open); break;
+                    case 2: fmt::format_to(it, "{:.2f}", k.high); break;
+                    case 3: fmt::format_to(it, "{:.2f}", k.low); break;
+                    case 4: fmt::format_to(it, "{:.2f}", k.close); break;
+                    case 5: fmt::format_to(it, "{:.2f}", k.volume); break;
+                    case 6: fmt::format_to(it, "{}", k.close_time); break;
+                }
+            },
+            [&](size_t a, size_t b, size_t column) {
+                const KlineData& ka = klines[a];
+                const KlineData& kb = klines[b];
+                switch (column) {
+                    case 1: return ka.open < kb.open;
+                    case 2: return ka.high < kb.high;
+                    case 3: return ka.low < kb.low;
+                    case 4: return ka.close < kb.close;
+                    case 5: return ka.volume < kb.volume;
+                    case 6: return ka.close_time < kb.close_time;
+                    default: return ka.open_time < kb.open_time;
+                }
+            });
     }
 
-    const float halfWidth = 0.35f;
-
     if (ImPlot::BeginPlot("Candles", ImVec2(-1, -1))) {
         ImPlot::SetupAxis(ImAxis_X1, "Index", ImPlotAxisFlags_None);
         ImPlot::SetupAxisFormat(ImAxis_X1, "%.0f");
@@ -40,28 +104,43 @@ void chartDisplayWindow(GLFWwindow* window, int windowWidth, int windowHeight,
         ImPlot::SetupAxis(ImAxis_Y1, "Price", ImPlotAxisFlags_None);
         ImPlot::SetupAxisLimitsConstraints(ImAxis_Y1, 0.0, INFINITY);
 
-        int total = static_cast<int>(klines.size());
-        ImPlot::SetupAxesLimits(0.0, static_cast<double>(total), 0.0, 100.0, ImPlotCond_Once);
+        size_t total = klines.size();
+        ImPlot::SetupAxesLimits(0.0, static_cast<double>(total), 0.0, 100.0,
+                                timeframeChanged ? ImPlotCond_Always : ImPlotCond_Once);
 
-        ImPlot::PushPlotClipRect();
-        ImDrawList* drawList = ImPlot::GetPlotDrawList();
-
-        for (int i = 0; i < total; ++i) {
-            const KlineData& k = klines[i];
-            float x = static_cast<float>(i);
+        // X is the candle index, so the visible slice comes straight from the axis limits
+        ImPlotRect limits = ImPlot::GetPlotLimits();
+        size_t first = static_cast<size_t>(std::clamp(std::floor(limits.X.Min), 0.0, static_cast<double>(total)));
+        size_t last  = static_cast<size_t>(std::clamp(std::ceil(limits.X.Max) + 1.0, 0.0, static_cast<double>(total)));
 
-            ImU32 color = (k.close > k.open) ? IM_COL32(0, 255, 0, 255) :
-                           (k.close < k.open) ? IM_COL32(255, 0, 0, 255) :
-                                                IM_COL32(180, 180, 180, 255);
+        double plotWidth = std::max(1.0, static_cast<double>(ImPlot::GetPlotSize().x));
+        double candlesPerPixel = (limits.X.Max - limits.X.Min) / plotWidth;
 
-            ImVec2 pHigh  = ImPlot::PlotToPixels(ImVec2(x, static_cast<float>(k.high)));
-            ImVec2 pLow   = ImPlot::PlotToPixels(ImVec2(x, static_cast<float>(k.low)));
-            ImVec2 pOpen  = ImPlot::PlotToPixels(ImVec2(x - halfWidth, static_cast<float>(k.open)));
-            ImVec2 pClose = ImPlot::PlotToPixels(ImVec2(x + halfWidth, static_cast<float>(k.close)));
+        ImPlot::PushPlotClipRect();
+        ImDrawList* drawList = ImPlot::GetPlotDrawList();
 
-            drawList->AddLine(pHigh, pLow, color, 1.5f);
-            drawList->AddRectFilled(pOpen, pClose, color);
-            drawList->AddRect(pOpen, pClose, IM_COL32(0, 0, 0, 255), 0.0f, 0, 1.0f);
+        if (candlesPerPixel * kMinPixelsPerCandle <= 1.0) {
+            for (size_t i = first; i < last; ++i) {
+                const KlineData& k = klines[i];
+                drawCandle(drawList, static_cast<double>(i), kCandleHalfWidth,
+                           k.open, k.high, k.low, k.close, true);
+            }
+        } else {
+            // Zoomed out: merge candles into buckets about one pixel column wide.
+            // Buckets are aligned to absolute indices so panning does not reshuffle them.
+            size_t step = std::max<size_t>(1, static_cast<size_t>(std::ceil(candlesPerPixel)));
+            for (size_t start = first - first % step; start < last; start += step) {
+                size_t end = std::min(start + step, total);
+                double high = klines[start].high;
+                double low = klines[start].low;
+                for (size_t i = start + 1; i < end; ++i) {
+                    high = std::max(high, klines[i].high);
+                    low = std::min(low, klines[i].low);
+                }
+                double center = 0.5 * static_cast<double>(start + end - 1);
+                drawCandle(drawList, center, kCandleHalfWidth * static_cast<double>(step),
+                           klines[start].open, high, low, klines[end - 1].close, false);
+            }
         }
 
         ImPlot::PopPlotClipRect();
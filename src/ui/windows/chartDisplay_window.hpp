@@ -2,10 +2,14 @@
 #include <GLFW/glfw3.h>
 #include <vector>
 #include <core/binance_kline.hpp>
+#include <core/bar_series.hpp>
+#include <core/timeframe_resampler.hpp>
 #include <core/flatbuffers/Binance/binance_kline_generated.h>
 #include <deque>
+#include <array>
 
 void chartDisplayWindow(GLFWwindow* window,
                               int windowWidth,
                               int windowHeight,
-                              const std::deque<KlineData>& klines);
\ No newline at end of file
+                              const std::array<BarSeries, kTimeframeCount>& barsByTimeframe,
+                              const std::array<uint64_t, kTimeframeCount>& barsVersion);
\ No newline at end of file
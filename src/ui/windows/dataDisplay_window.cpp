@@ -3,7 +3,8 @@
 #include <implot.h>
 #include <vector>
 #include <algorithm>
-#include <fmt/core.h>
+#include <iterator>
+#include <fmt/format.h>
 
 #include "ui/plots/price_plot.hpp"
 #include "ui/plots/sma_plot.hpp"
@@ -14,6 +15,7 @@
 
 #include "ui/backtest_plots/sma_crossover_plot.hpp" // UTILIZED TO PLOT THE SMA CROSSOVER BACKTEST VECTOR
 #include "ui/backtest_plots/macd_vwapBacktester_plot.hpp" // UTILIZED TO PLOT THE MACD VWAP BACKTEST VECTOR
+#include "ui/widgets/virtual_table.hpp"
 
 #include "core/backtest_engines/Trade.hpp"
 #include "core/backtest_engines/sma_crossover.hpp" // UTILIZED TO GET THE SMA CROSSOVER BACKTEST VECTOR
@@ -59,20 +61,42 @@ void dataDisplayWindow(GLFWwindow* window, int windowWidth, int windowHeight, st
         );
 
         ImGui::Text(fmt::format("Ticker data size: {}", tickDataVector.size()).c_str());
-        /* ------------------ DEBUGGING ----------------- 
-        ImGui::Text("MACD + VWAP Backtest Trades:");
-        ImGui::BeginChild("TradeLogScroll", ImVec2(0, 200), true); // scrollable area, 200px tall
-
-        for (size_t i = 0; i < macd_vwap_backtest_tradeVector.size(); ++i) {
-            const Trade& t = macd_vwap_backtest_tradeVector[i];
-            ImGui::Text("[%zu] Date: %s | Type: %s | Shares: %d | Strike: %.2f | UnrealizedPnL: %.2f | RealizedPnL: %.2f",
-                i, t.execution_date.c_str(), t.order_type.c_str(), t.shares,
-                t.strike_price, t.unrealizedPnL, t.realizedPnL
-            );
+        // ------------------ TRADE LOG ------------------
+        // Trades only change when the tick data does; rows are formatted on screen only
+        static VirtualTable tradeLog({
+            {"#", 50.0f}, {"Date"}, {"Type"}, {"Shares"}, {"Strike"}, {"UnrealizedPnL"}, {"RealizedPnL"}
+        });
+        if (ImGui::CollapsingHeader("MACD + VWAP Backtest Trades")) {
+            const std::vector<Trade>& trades = macd_vwap_backtest_tradeVector;
+            tradeLog.draw("TradeLog", trades.size(), tickDataVector.size(),
+                [&](size_t row, size_t column, std::string& out) {
+                    const Trade& t = trades[row];
+                    auto it = std::back_inserter(out);
+                    switch (column) {
+                        case 0: fmt::format_to(it, "{}", row); break;
+                        case 1: out += t.execution_date; break;
+                        case 2: out += t.order_type; break;
+                        case 3: fmt::format_to(it, "{}", t.shares); break;
+                        case 4: fmt::format_to(it, "{:.2f}", t.strike_price); break;
+                        case 5: fmt::format_to(it, "{:.2f}", t.unrealizedPnL); break;
+                        case 6: fmt::format_to(it, "{:.2f}", t.realizedPnL); break;
+                    }
+                },
+                [&](size_t a, size_t b, size_t column) {
+                    const Trade& ta = trades[a];
+                    const Trade& tb = trades[b];
+                    switch (column) {
+                        case 1: return ta.execution_date < tb.execution_date;
+                        case 2: return ta.order_type < tb.order_type;
+                        case 3: return ta.shares < tb.shares;
+                        case 4: return ta.strike_price < tb.strike_price;
+                        case 5: return ta.unrealizedPnL < tb.unrealizedPnL;
+                        case 6: return ta.realizedPnL < tb.realizedPnL;
+                        default: return a < b;
+                    }
+                });
         }
-
-        ImGui::EndChild();
-        // ------------------DEBUGGING-------------------- */
+        // ------------------ TRADE LOG ------------------
 
         // Compute VWAP
         std::vector<double> vwap_values = vwapCalc(tickDataVector);
@@ -4,6 +4,9 @@
 #include <vector>
 #include <string>
 #include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstring>
 #include "../../core/flatbuffers/Binance/binance_bookticker_generated.h"
 #include "../../core/net/zmq_control_client.hpp"
 
@@ -11,14 +14,16 @@ void orderBookDisplayWindow(
     GLFWwindow* window,
     int windowWidth,
     int windowHeight,
-    const std::vector<std::string>& availableSymbols,
+    const SymbolSearchIndex& symbolSearch,
     //const std::vector<uint8_t>& latestCryptoMessage,
     //ZMQControlClient& controlClient,
     FileLogger& logger,
     std::vector<SymbolRequest>& pendingRRequests,
     std::vector<WindowBBO>& activeBBOWindows,
-    int& windowID
+    int& windowID,
+    const OrderBookView* orderBook
 ) {
+    const SymbolRegistry& availableSymbols = symbolSearch.registry();
 
     ImGui::SetNextWindowPos(ImVec2(60, 60), ImGuiCond_Once);
     ImGui::SetNextWindowSize(ImVec2(900, 350), ImGuiCond_Once);
@@ -30,7 +35,10 @@ void orderBookDisplayWindow(
     }
 
     // Begin ImGui window with close button support
-    if (!ImGui::Begin(("Orderbook Display##" + std::to_string(windowID)).c_str(), &windowOpen, ImGuiWindowFlags_NoCollapse)) {
+    // NOTE: widget IDs below are scoped by this window, so they need no per-window suffix
+    char title[48];
+    std::snprintf(title, sizeof(title), "Orderbook Display##%d", windowID);
+    if (!ImGui::Begin(title, &windowOpen, ImGuiWindowFlags_NoCollapse)) {
         ImGui::End();
         return;
     }
@@ -56,28 +64,29 @@ void orderBookDisplayWindow(
     ImGui::PushStyleColor(ImGuiCol_WindowBg, ImVec4(0.10f, 0.10f, 0.10f, 1.0f));
     ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.90f, 0.90f, 0.90f, 1.0f));
 
-    ImGui::Text("Live Crypto BookTicker");
+    ImGui::Text("Live Crypto Order Book");
     ImGui::Separator();
 
     // -------------------------
     // Symbol Search Box
     // -------------------------
-    // Per-window search buffer
+    // Per-window search buffer + incremental search results
     static std::vector<std::array<char, 32>> searchBuffers;
+    static std::vector<SymbolSearchState> searchStates;
     if (searchBuffers.size() <= windowID) searchBuffers.resize(windowID + 1);
+    if (searchStates.size() <= windowID) searchStates.resize(windowID + 1);
     auto& searchBuf = searchBuffers[windowID];
+    auto& searchState = searchStates[windowID];
 
-    // Unique label per window
-    bool enterPressed = ImGui::InputText(("Symbol##" + std::to_string(windowID)).c_str(), searchBuf.data(), searchBuf.size(), ImGuiInputTextFlags_EnterReturnsTrue);
+    bool enterPressed = ImGui::InputText("Symbol", searchBuf.data(), searchBuf.size(), ImGuiInputTextFlags_EnterReturnsTrue);
+
+    // Only re-filters when the text actually changed (narrowing reuses the previous results)
+    searchState.update(symbolSearch, searchBuf.data());
 
 
-    auto isValidSymbol = [&](const std::string& s) {
-        return std::find(availableSymbols.begin(), availableSymbols.end(), s) != availableSymbols.end();
-    };
-    
     auto trySendChange = [&]() {
-        std::string symbol(searchBuf.data());
-        if (!isValidSymbol(symbol)) {
+        SymbolId symbol = availableSymbols.find(searchBuf.data());
+        if (symbol == kInvalidSymbolId) {
             logger.logInfo("[WARN] Invalid symbol, ignoring request.");
             return;
         }
@@ -94,7 +103,7 @@ void orderBookDisplayWindow(
     ImGui::SameLine();
 
     // Implement 1.5 second cooldown for the button LATER
-    if (ImGui::Button(("Select##" + std::to_string(windowID)).c_str())) {
+    if (ImGui::Button("Select")) {
         trySendChange(); 
     }
     if (enterPressed) { trySendChange(); }
@@ -102,16 +111,24 @@ void orderBookDisplayWindow(
     // -------------------------
     // Symbol List
     // -------------------------
-    if (ImGui::BeginChild(("symbols##" + std::to_string(windowID)).c_str(), ImVec2(200, 200), true)) {
-        for (size_t i = 0; i < availableSymbols.size(); ++i) {
-            const auto& sym = availableSymbols[i];
-            if (ImGui::Selectable((sym + "##" + std::to_string(windowID) + "_" + std::to_string(i)).c_str())) {
-                strncpy(searchBuf.data(), sym.c_str(), searchBuf.size() - 1);
-                searchBuf[searchBuf.size() - 1] = '\0';
+    // Virtualized: only the visible rows are submitted; labels are the interned names
+    if (ImGui::BeginChild("symbols", ImVec2(200, 200), true)) {
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(searchState.results.size()));
+        while (clipper.Step()) {
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row) {
+                SymbolId id = searchState.results[row];
+                const std::string& sym = availableSymbols.name(id);
+                ImGui::PushID(static_cast<int>(id));
+                if (ImGui::Selectable(sym.c_str())) {
+                    strncpy(searchBuf.data(), sym.c_str(), searchBuf.size() - 1);
+                    searchBuf[searchBuf.size() - 1] = '\0';
+                }
+                ImGui::PopID();
             }
         }
-        ImGui::EndChild();
     }
+    ImGui::EndChild();
     ImGui::Dummy(ImVec2(0, 15));
 
     // -------------------------
@@ -121,7 +138,7 @@ void orderBookDisplayWindow(
         if (!activeBBOWindows[windowID].currentBBO.error.empty()) {
             ImGui::Text("Error retrieving BBO data: %s", activeBBOWindows[windowID].currentBBO.error.c_str());
         } else {
-            ImGui::TextColored(ImVec4(0.2f, 0.8f, 0.2f, 1.0f), "%s", activeBBOWindows[windowID].currentBBO.symbol.c_str());
+            ImGui::TextColored(ImVec4(0.2f, 0.8f, 0.2f, 1.0f), "%s", availableSymbols.name(activeBBOWindows[windowID].currentBBO.symbol).c_str());
             ImGui::SameLine();
             ImGui::Text("Bid: %.4f (%.2f) | Ask: %.4f (%.2f)",
                 activeBBOWindows[windowID].currentBBO.bid_price,
@@ -135,6 +152,52 @@ void orderBookDisplayWindow(
         ImGui::Text("Waiting for live data...");
     }
 
+    // -------------------------
+    // Depth Ladder
+    // -------------------------
+    static std::vector<int> displayLevels;
+    if (displayLevels.size() <= windowID) displayLevels.resize(windowID + 1, 10);
+    int& levels = displayLevels[windowID];
+    ImGui::SetNextItemWidth(200);
+    ImGui::SliderInt("Levels", &levels, 1, static_cast<int>(kBookViewLevels));
+
+    if (!orderBook) {
+        ImGui::Text("Waiting for depth data...");
+    } else {
+        if (orderBook->state != OrderBook::State::Synced) {
+            ImGui::TextColored(ImVec4(0.9f, 0.6f, 0.2f, 1.0f), "Depth resyncing...");
+        } else {
+            ImGui::Text("Depth (update %llu)", static_cast<unsigned long long>(orderBook->lastUpdateId));
+        }
+
+        size_t rows = std::min(static_cast<size_t>(levels), std::max(orderBook->bids.size(), orderBook->asks.size()));
+        ImGuiTableFlags tableFlags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchSame;
+        if (ImGui::BeginTable("depth", 4, tableFlags)) {
+            ImGui::TableSetupColumn("Bid Qty");
+            ImGui::TableSetupColumn("Bid");
+            ImGui::TableSetupColumn("Ask");
+            ImGui::TableSetupColumn("Ask Qty");
+            ImGui::TableHeadersRow();
+
+            const ImVec4 bidColor(0.2f, 0.8f, 0.2f, 1.0f);
+            const ImVec4 askColor(0.9f, 0.3f, 0.3f, 1.0f);
+            for (size_t row = 0; row < rows; ++row) {
+                ImGui::TableNextRow();
+                if (row < orderBook->bids.size()) {
+                    const BookLevel& bid = orderBook->bids[row];
+                    ImGui::TableSetColumnIndex(0); ImGui::Text("%.4f", bid.quantity);
+                    ImGui::TableSetColumnIndex(1); ImGui::TextColored(bidColor, "%.4f", bid.price);
+                }
+                if (row < orderBook->asks.size()) {
+                    const BookLevel& ask = orderBook->asks[row];
+                    ImGui::TableSetColumnIndex(2); ImGui::TextColored(askColor, "%.4f", ask.price);
+                    ImGui::TableSetColumnIndex(3); ImGui::Text("%.4f", ask.quantity);
+                }
+            }
+            ImGui::EndTable();
+        }
+    }
+
     ImGui::PopStyleColor(2);
     ImGui::End();
 }
\ No newline at end of file
@@ -8,16 +8,20 @@
 #include "core/window_state.hpp"
 #include "core/SymbolRequest.hpp"
 #include "core/BBO.hpp"
+#include "core/order_book.hpp"
+#include "core/symbol_registry.hpp"
+#include "core/symbol_search.hpp"
 
 void orderBookDisplayWindow(
     GLFWwindow* window,
     int windowWidth,
     int windowHeight,
-    const std::vector<std::string>& availableSymbols,
+    const SymbolSearchIndex& symbolSearch,
     //const std::vector<uint8_t>& latestCryptoMessage,
     //ZMQControlClient& controlClient,
     FileLogger& logger,
     std::vector<SymbolRequest>& pendingRRequests,
     std::vector<WindowBBO>& activeWindows,
-    int& windowID
+    int& windowID,
+    const OrderBookView* orderBook // Depth for this window's symbol, nullptr until any arrives
 );
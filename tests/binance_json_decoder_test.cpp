@@ -0,0 +1,68 @@
+// Decodes real Binance websocket payloads (upper-case symbols) against a registry
+// built like the app's, from the lower-case names of binance_symbols.json
+#include <cstdio>
+#include <string_view>
+#include "core/BinanceJsonDecoder.hpp"
+
+namespace {
+
+int failures = 0;
+
+void check(bool ok, const char* what) {
+    if (ok) return;
+    std::fprintf(stderr, "FAILED: %s\n", what);
+    ++failures;
+}
+
+} // namespace
+
+int main() {
+    const SymbolRegistry symbols({"bnbbtc", "btcusdt", "ethusdt"});
+    std::string_view data;
+
+    {
+        constexpr std::string_view message =
+            R"({"stream":"btcusdt@bookTicker","data":{"u":400900217,"s":"BTCUSDT","b":"64123.45","B":"1.25","a":"64123.46","A":"0.75"}})";
+        check(classifyBinanceJson(message, data) == BinanceJsonEvent::BookTicker, "bookTicker classified");
+        BBO bbo;
+        check(decodeBookTickerJson(data, symbols, bbo), "bookTicker decoded");
+        check(bbo.symbol == symbols.find("btcusdt"), "bookTicker symbol");
+        check(bbo.bid_price == 64123.45 && bbo.ask_quantity == 0.75, "bookTicker prices");
+    }
+
+    {
+        constexpr std::string_view message =
+            R"({"stream":"bnbbtc@kline_1m","data":{"e":"kline","E":1672515782136,"s":"BNBBTC","k":{"t":1672515780000,"T":1672515839999,"s":"BNBBTC","i":"1m","o":"0.0010","c":"0.0020","h":"0.0025","l":"0.0015","v":"1000","x":true}}})";
+        check(classifyBinanceJson(message, data) == BinanceJsonEvent::Kline, "kline classified");
+        SymbolId symbol = kInvalidSymbolId;
+        KlineData kline;
+        bool closed = false;
+        check(decodeKlineJson(data, symbols, symbol, kline, closed), "kline decoded");
+        check(symbol == symbols.find("bnbbtc"), "kline symbol");
+        check(kline.open_time == 1672515780000 && kline.high == 0.0025, "kline fields");
+        check(closed, "kline final flag");
+    }
+
+    {
+        constexpr std::string_view message =
+            R"({"e":"trade","E":1672515782136,"s":"ETHUSDT","t":12345,"p":"3012.5","q":"0.4","T":1672515782134,"m":true,"M":true})";
+        check(classifyBinanceJson(message, data) == BinanceJsonEvent::Trade, "trade classified");
+        SymbolId symbol = kInvalidSymbolId;
+        TradeData trade;
+        check(decodeTradeJson(data, symbols, symbol, trade), "trade decoded");
+        check(symbol == symbols.find("ethusdt"), "trade symbol");
+        check(trade.price == 3012.5 && trade.is_buyer_maker, "trade fields");
+    }
+
+    {
+        constexpr std::string_view message =
+            R"({"e":"trade","E":1,"s":"DOGEUSDT","t":1,"p":"0.1","q":"1","T":1,"m":false})";
+        classifyBinanceJson(message, data);
+        SymbolId symbol = kInvalidSymbolId;
+        TradeData trade;
+        check(!decodeTradeJson(data, symbols, symbol, trade), "unknown symbol rejected");
+    }
+
+    if (failures == 0) std::printf("binance_json_decoder_test: all checks passed\n");
+    return failures == 0 ? 0 : 1;
+}